@@ -0,0 +1,101 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGATOMIC_H
+#define PROJECT_SNUGATOMIC_H
+
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+#include "SnugInt.h"
+
+/**
+ * \brief Thread safe checked integer
+ *
+ * \details
+ * A SnugAtomic<Type> is a std::atomic<Type> whose read modify write operations reject overflow atomically,
+ * a failed operation leaves the value untouched and is handed to the Policy (a saturating or wrapping
+ * Policy stores its value instead).
+ *
+ * \details
+ * - Every add, subtract and multiply is a compare exchange loop that checks the value it read and only stores
+ *   a result that fits, so readers and other writers never see a value that was not the result of a completed
+ *   operation. A fetch_add that is checked afterwards would have to store its unchecked sum first
+ *
+ * \details
+ * - Under heavy contention on one counter the loop retries, SnugCounter spreads the adds over per thread slots
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugAtomic<std::uint64_t> budget{limit};
+ *budget.fetch_sub(bytes);       // throws SnugInt_Subtraction_Underflow_Exception when the budget is spent
+ *++requests;
+ * \endcode
+ * @tparam Type integer to do operations with
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+ */
+template<class Type, class Policy = SnugIntThrowPolicy>
+class SnugAtomic
+{
+    static_assert(std::is_integral<Type>::value, "SnugAtomic must be an integral");
+    static_assert(sizeof(Type) <= 8, "SnugAtomic supports integrals of up to 64 bits");
+public:
+    // Constructors
+    constexpr SnugAtomic() noexcept : value(0) {};
+    constexpr SnugAtomic(Type item) noexcept : value(item) {};
+    constexpr SnugAtomic(const SnugInt<Type, Policy>& item) noexcept : value(item.getValue()) {};
+    SnugAtomic(const SnugAtomic&) = delete;
+
+    // Assignment Operators
+    SnugAtomic& operator = (const SnugAtomic&) = delete;
+    Type operator = (Type item) noexcept { store(item); return item; };
+
+    // Accessor Operators
+    Type load(std::memory_order order = std::memory_order_seq_cst) const noexcept { return value.load(order); };
+    void store(Type item, std::memory_order order = std::memory_order_seq_cst) noexcept { value.store(item, order); };
+    operator SnugInt<Type, Policy>() const noexcept { return SnugInt<Type, Policy>(load()); };
+    bool is_lock_free() const noexcept { return value.is_lock_free(); };
+
+    // Non throwing Operations, the value of the result is the previous value, or the value that failed
+    SnugIntResult<Type> TryFetchAdd(Type delta, std::memory_order order = std::memory_order_seq_cst) noexcept;
+    SnugIntResult<Type> TryFetchSub(Type delta, std::memory_order order = std::memory_order_seq_cst) noexcept;
+    SnugIntResult<Type> TryFetchMult(Type factor, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    // Checked Operations, return the previous value like std::atomic
+    Type fetch_add(Type delta, std::memory_order order = std::memory_order_seq_cst) noexcept(Policy::nothrow);
+    Type fetch_sub(Type delta, std::memory_order order = std::memory_order_seq_cst) noexcept(Policy::nothrow);
+    Type fetch_mul(Type factor, std::memory_order order = std::memory_order_seq_cst) noexcept(Policy::nothrow);
+
+    // Checked Operators, return the stored value like std::atomic
+    Type operator += (Type delta) noexcept(Policy::nothrow);
+    Type operator -= (Type delta) noexcept(Policy::nothrow);
+    Type operator *= (Type factor) noexcept(Policy::nothrow);
+    Type operator ++ () noexcept(Policy::nothrow) { return *this += static_cast<Type>(1); };
+    Type operator ++ (int) noexcept(Policy::nothrow) { return fetch_add(static_cast<Type>(1)); };
+    Type operator -- () noexcept(Policy::nothrow) { return *this -= static_cast<Type>(1); };
+    Type operator -- (int) noexcept(Policy::nothrow) { return fetch_sub(static_cast<Type>(1)); };
+private:
+    std::atomic<Type> value; /**< stored value */
+
+    template<class Operation> SnugIntResult<Type> TryExchange(Operation operation, std::memory_order order) noexcept;
+    template<class Operation> Type Exchange(Operation operation, std::memory_order order, Type& next) noexcept(Policy::nothrow);
+};
+
+#include "SnugAtomic.tpp"
+
+#endif //PROJECT_SNUGATOMIC_H
@@ -0,0 +1,204 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include "SnugAtomic.h"
+
+/**
+ * \brief Compare exchange loop of the non throwing operations
+ *
+ * \details
+ * Nothing is stored when operation fails on the value read
+ *
+ * @tparam Operation callable taking the current value and returning a SnugIntResult
+ * @param operation the checked operation
+ * @param order memory order of a successful exchange
+ * @return the previous value, or the value operation failed on and its error
+ */
+template<class Type, class Policy>
+template<class Operation>
+SnugIntResult<Type> SnugAtomic<Type, Policy>::TryExchange(Operation operation, std::memory_order order) noexcept
+{
+    SnugIntResult<Type> result = {value.load(std::memory_order_relaxed), SnugIntError::None};
+    for (;;)
+    {
+        const SnugIntResult<Type> next = operation(result.value);
+        if (SNUGINT_UNLIKELY(!next.ok()))
+        {
+            result.error = next.error;
+            return result;
+        }
+        if (value.compare_exchange_weak(result.value, next.value, order, std::memory_order_relaxed))
+            return result;
+    }
+}
+
+/**
+ * \brief Compare exchange loop of the checked operations
+ *
+ * \details
+ * A failed operation goes to the Policy before anything is stored, a throwing Policy leaves the value
+ * untouched, any other stores what the Policy returns
+ *
+ * @tparam Operation callable taking the current value and returning a SnugIntResult
+ * @param operation the checked operation
+ * @param order memory order of the exchange
+ * @param next receives the stored value
+ * @return the previous value
+ */
+template<class Type, class Policy>
+template<class Operation>
+Type SnugAtomic<Type, Policy>::Exchange(Operation operation, std::memory_order order, Type& next) noexcept(Policy::nothrow)
+{
+    Type previous = value.load(std::memory_order_relaxed);
+    do
+        next = SnugInt<Type, Policy>::Resolve(operation(previous));
+    while (!value.compare_exchange_weak(previous, next, order, std::memory_order_relaxed));
+
+    return previous;
+}
+
+/**
+ * \brief Adds delta without throwing
+ *
+ * @param delta value to add
+ * @param order memory order of the update
+ * @return the previous value, or the current value and AdditionOverflow / AdditionUnderflow
+ */
+template<class Type, class Policy>
+SnugIntResult<Type> SnugAtomic<Type, Policy>::TryFetchAdd(Type delta, std::memory_order order) noexcept
+{
+    return TryExchange([delta](Type item) { return SnugInt<Type, Policy>::TryAdd(item, delta); }, order);
+}
+
+/**
+ * \brief Subtracts delta without throwing
+ *
+ * @param delta value to subtract
+ * @param order memory order of the update
+ * @return the previous value, or the current value and SubtractionOverflow / SubtractionUnderflow
+ */
+template<class Type, class Policy>
+SnugIntResult<Type> SnugAtomic<Type, Policy>::TryFetchSub(Type delta, std::memory_order order) noexcept
+{
+    return TryExchange([delta](Type item) { return SnugInt<Type, Policy>::TrySub(item, delta); }, order);
+}
+
+/**
+ * \brief Multiplies by factor without throwing, always a compare exchange loop
+ *
+ * @param factor value to multiply by
+ * @param order memory order of the update
+ * @return the previous value, or the current value and MultiplicationOverflow / MultiplicationUnderflow
+ */
+template<class Type, class Policy>
+SnugIntResult<Type> SnugAtomic<Type, Policy>::TryFetchMult(Type factor, std::memory_order order) noexcept
+{
+    return TryExchange([factor](Type item) { return SnugInt<Type, Policy>::TryMult(item, factor); }, order);
+}
+
+/**
+ * \brief Adds delta atomically
+ *
+ * \details
+ * a <b>SNUGINT_ADD_EXCEPTION</b> will be thrown, without changing the value, if the sum does not fit
+ *
+ * @param delta value to add
+ * @param order memory order of the update
+ * @return the previous value
+ */
+template<class Type, class Policy>
+Type SnugAtomic<Type, Policy>::fetch_add(Type delta, std::memory_order order) noexcept(Policy::nothrow)
+{
+    Type next = 0;
+    return Exchange([delta](Type item) { return SnugInt<Type, Policy>::TryAdd(item, delta); }, order, next);
+}
+
+/**
+ * \brief Subtracts delta atomically
+ *
+ * \details
+ * a <b>SNUGINT_SUB_EXCEPTION</b> will be thrown, without changing the value, if the difference does not fit
+ *
+ * @param delta value to subtract
+ * @param order memory order of the update
+ * @return the previous value
+ */
+template<class Type, class Policy>
+Type SnugAtomic<Type, Policy>::fetch_sub(Type delta, std::memory_order order) noexcept(Policy::nothrow)
+{
+    Type next = 0;
+    return Exchange([delta](Type item) { return SnugInt<Type, Policy>::TrySub(item, delta); }, order, next);
+}
+
+/**
+ * \brief Multiplies by factor atomically
+ *
+ * \details
+ * a <b>SNUGINT_MULT_EXCEPTION</b> will be thrown, without changing the value, if the product does not fit
+ *
+ * @param factor value to multiply by
+ * @param order memory order of the update
+ * @return the previous value
+ */
+template<class Type, class Policy>
+Type SnugAtomic<Type, Policy>::fetch_mul(Type factor, std::memory_order order) noexcept(Policy::nothrow)
+{
+    Type next = 0;
+    return Exchange([factor](Type item) { return SnugInt<Type, Policy>::TryMult(item, factor); }, order, next);
+}
+
+/**
+ * \brief SnugAtomic addition assignment operator
+ *
+ * @param delta value to add
+ * @return the stored value
+ */
+template<class Type, class Policy>
+Type SnugAtomic<Type, Policy>::operator+=(Type delta) noexcept(Policy::nothrow)
+{
+    Type next = 0;
+    Exchange([delta](Type item) { return SnugInt<Type, Policy>::TryAdd(item, delta); }, std::memory_order_seq_cst, next);
+    return next;
+}
+
+/**
+ * \brief SnugAtomic subtraction assignment operator
+ *
+ * @param delta value to subtract
+ * @return the stored value
+ */
+template<class Type, class Policy>
+Type SnugAtomic<Type, Policy>::operator-=(Type delta) noexcept(Policy::nothrow)
+{
+    Type next = 0;
+    Exchange([delta](Type item) { return SnugInt<Type, Policy>::TrySub(item, delta); }, std::memory_order_seq_cst, next);
+    return next;
+}
+
+/**
+ * \brief SnugAtomic multiplication assignment operator
+ *
+ * @param factor value to multiply by
+ * @return the stored value
+ */
+template<class Type, class Policy>
+Type SnugAtomic<Type, Policy>::operator*=(Type factor) noexcept(Policy::nothrow)
+{
+    Type next = 0;
+    Exchange([factor](Type item) { return SnugInt<Type, Policy>::TryMult(item, factor); }, std::memory_order_seq_cst, next);
+    return next;
+}
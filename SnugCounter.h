@@ -0,0 +1,125 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGCOUNTER_H
+#define PROJECT_SNUGCOUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+
+#include "SnugInt.h"
+#include "SnugAtomic.h"
+#include "SnugIntReduce.h"
+
+/**
+ * \brief Sharded checked counter
+ *
+ * \details
+ * Every thread adds into one of Shards slots, each on its own cache line, instead of the shared total. A slot
+ * keeps at most flush_at pending, an add that would take it past flush_at merges the slot and the add into
+ * the SnugAtomic total in one checked fetch_add. Overflow of the counter is caught at that merge, and a failed
+ * merge leaves the counter untouched before the Policy sees it (a saturating or wrapping Policy then stores
+ * its value in the total).
+ *
+ * \details
+ * - An add the slot takes is only checked against the total at its merge, so near max an add is accepted
+ *   and the merge after it fails. From then on every merge of that slot fails and exact() reports the overflow
+ *
+ * \details
+ * - Threads get a slot round robin on their first add, more threads than Shards share slots, which stays
+ *   correct and only brings back some of the contention. A slot per CPU would need restartable sequences,
+ *   which have no portable form
+ *
+ * \details
+ * - approximate() reads only the total and lags by at most Shards * flush_at, exact() adds every slot into
+ *   a 128 bit accumulator with one range check at the end and is exact whenever no add runs concurrently, flush() merges every slot into the total
+ *
+ * \details
+ * - Adds larger than flush_at, and every subtraction of an unsigned counter, go straight to the total
+ *
+ * \details
+ * - The slots are over aligned, allocating a SnugCounter with new before C++17 does not honour that
+ *   alignment and only costs the padding
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *static SnugCounter<std::uint32_t> requests;
+ *++requests;                                   // a slot local add, the total is touched every flush_at adds
+ *std::uint32_t seen = requests.approximate();
+ *std::uint32_t all = requests.exact();         // throws SnugInt_Addition_Overflow_Exception past 2^32 - 1
+ * \endcode
+ * @tparam Type integer to count with
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+ * @tparam Shards number of slots, a power of two
+ */
+template<class Type, class Policy = SnugIntThrowPolicy, std::size_t Shards = 32>
+class SnugCounter
+{
+    static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "SnugCounter needs a power of two of Shards");
+public:
+    static constexpr Type max_flush = static_cast<Type>(std::numeric_limits<Type>::max() / 4); /**< largest flush_at, slots can never overflow below it */
+    static constexpr Type default_flush = max_flush < 4096 ? max_flush : static_cast<Type>(4096); /**< flush_at when none is given */
+
+    // Constructors
+    SnugCounter() noexcept : SnugCounter(0) {};
+    explicit SnugCounter(Type initial, Type flush_at = default_flush) noexcept;
+    SnugCounter(const SnugCounter&) = delete;
+    SnugCounter& operator = (const SnugCounter&) = delete;
+
+    // Non throwing Operations, a failed operation leaves the counter untouched
+    SnugIntError TryAdd(Type delta) noexcept { return Add(delta, false); };
+    SnugIntError TrySub(Type delta) noexcept { return Sub(delta, false); };
+    SnugIntResult<Type> TryExact() const noexcept;
+    SnugIntError TryFlush() noexcept { return Flush(false); };
+
+    // Checked Operations
+    void add(Type delta) noexcept(Policy::nothrow) { Add(delta, true); };
+    void sub(Type delta) noexcept(Policy::nothrow) { Sub(delta, true); };
+    Type exact() const noexcept(Policy::nothrow) { return SnugInt<Type, Policy>::Resolve(TryExact()); };
+    void flush() noexcept(Policy::nothrow) { Flush(true); };
+    Type approximate() const noexcept { return total.load(std::memory_order_relaxed); };
+    Type flush_at() const noexcept { return limit; };
+
+    // Checked Operators
+    SnugCounter& operator += (Type delta) noexcept(Policy::nothrow) { add(delta); return *this; };
+    SnugCounter& operator -= (Type delta) noexcept(Policy::nothrow) { sub(delta); return *this; };
+    SnugCounter& operator ++ () noexcept(Policy::nothrow) { add(static_cast<Type>(1)); return *this; };
+    SnugCounter& operator -- () noexcept(Policy::nothrow) { sub(static_cast<Type>(1)); return *this; };
+private:
+    /**
+     * \brief Pending count of the threads using one slot, alone on its cache line
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<Type> pending;
+    };
+
+    alignas(64) SnugAtomic<Type, Policy> total; /**< merged count */
+    Type limit;                                 /**< flush_at, the largest pending of a slot */
+    Slot slots[Shards];                         /**< per thread pending counts */
+
+    static Slot& Local(Slot (&slots)[Shards]) noexcept;
+    SnugIntError Add(Type delta, bool resolve) noexcept(Policy::nothrow);
+    SnugIntError Sub(Type delta, bool resolve) noexcept(Policy::nothrow);
+    SnugIntError Merge(Slot& slot, Type delta, bool resolve) noexcept(Policy::nothrow);
+    SnugIntError Flush(bool resolve) noexcept(Policy::nothrow);
+};
+
+#include "SnugCounter.tpp"
+
+#endif //PROJECT_SNUGCOUNTER_H
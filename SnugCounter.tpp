@@ -0,0 +1,196 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include "SnugCounter.h"
+
+template<class Type, class Policy, std::size_t Shards> constexpr Type SnugCounter<Type, Policy, Shards>::max_flush;
+template<class Type, class Policy, std::size_t Shards> constexpr Type SnugCounter<Type, Policy, Shards>::default_flush;
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief Slot index of the calling thread, handed out round robin on first use
+     */
+    inline std::size_t CounterSlot() noexcept
+    {
+        static std::atomic<std::size_t> next(0);
+        static thread_local const std::size_t slot = next.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+}
+}
+
+/**
+ * \brief SnugCounter constructor
+ *
+ * @param initial starting value of the total
+ * @param flush_at largest pending count of a slot, clamped to max_flush
+ */
+template<class Type, class Policy, std::size_t Shards>
+SnugCounter<Type, Policy, Shards>::SnugCounter(Type initial, Type flush_at) noexcept
+    : total(initial), limit(snug::detail::IsNegative(flush_at) ? static_cast<Type>(0) : flush_at > max_flush ? max_flush : flush_at)
+{
+    for (Slot& slot : slots)
+        slot.pending.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * \brief The slot of the calling thread
+ */
+template<class Type, class Policy, std::size_t Shards>
+typename SnugCounter<Type, Policy, Shards>::Slot& SnugCounter<Type, Policy, Shards>::Local(Slot (&slots)[Shards]) noexcept
+{
+    return slots[snug::detail::CounterSlot() & (Shards - 1)];
+}
+
+/**
+ * \brief Adds delta to the slot of the calling thread
+ *
+ * \details
+ * The local check keeps the slot within [-flush_at, flush_at] ([0, flush_at] unsigned), an add that would
+ * leave that range is merged into the total instead. Both sides are at most max_flush so the slot sum
+ * itself can never overflow
+ *
+ * @param delta value to add
+ * @param resolve true to hand a failed merge to the Policy
+ * @return the error of the merge, None if counted
+ */
+template<class Type, class Policy, std::size_t Shards>
+SnugIntError SnugCounter<Type, Policy, Shards>::Add(Type delta, bool resolve) noexcept(Policy::nothrow)
+{
+    const Type lower = std::is_signed<Type>::value ? static_cast<Type>(0 - limit) : static_cast<Type>(0);
+    if (delta > limit || delta < lower)
+    {
+        if (!resolve)
+            return total.TryFetchAdd(delta, std::memory_order_relaxed).error;
+        total.fetch_add(delta, std::memory_order_relaxed);
+        return SnugIntError::None;
+    }
+
+    Slot& slot = Local(slots);
+    Type pending = slot.pending.load(std::memory_order_relaxed);
+    Type next;
+    do
+    {
+        next = static_cast<Type>(pending + delta);
+        if (next > limit || next < lower)
+            return Merge(slot, delta, resolve);
+    } while (!slot.pending.compare_exchange_weak(pending, next, std::memory_order_relaxed));
+
+    snug::detail::Record(SnugIntOperation::Add, SnugIntResult<Type>{next, SnugIntError::None});
+    return SnugIntError::None;
+}
+
+/**
+ * \brief Subtracts delta, through the slot when Type is signed
+ *
+ * \details
+ * An unsigned slot only counts up, so an unsigned subtraction is checked against the total directly
+ *
+ * @param delta value to subtract
+ * @param resolve true to hand a failure to the Policy
+ * @return the error, None if counted
+ */
+template<class Type, class Policy, std::size_t Shards>
+SnugIntError SnugCounter<Type, Policy, Shards>::Sub(Type delta, bool resolve) noexcept(Policy::nothrow)
+{
+    if (std::is_signed<Type>::value && delta != std::numeric_limits<Type>::min())
+        return Add(static_cast<Type>(0 - delta), resolve);
+
+    if (!resolve)
+        return total.TryFetchSub(delta, std::memory_order_relaxed).error;
+    total.fetch_sub(delta, std::memory_order_relaxed);
+    return SnugIntError::None;
+}
+
+/**
+ * \brief Merges a slot and delta into the total
+ *
+ * \details
+ * A failed merge puts the pending count back so the counter is untouched. Resolved, a throwing Policy
+ * then throws, any other has the pending count and delta stored through the checked fetch_add of the total
+ *
+ * @param slot the slot to empty
+ * @param delta value to add along with the slot
+ * @param resolve true to hand a failure to the Policy
+ * @return the error of the merge, None if counted
+ */
+template<class Type, class Policy, std::size_t Shards>
+SnugIntError SnugCounter<Type, Policy, Shards>::Merge(Slot& slot, Type delta, bool resolve) noexcept(Policy::nothrow)
+{
+    const Type pending = slot.pending.exchange(0, std::memory_order_relaxed);
+    const Type combined = static_cast<Type>(pending + delta); // both at most max_flush
+    const SnugIntResult<Type> result = total.TryFetchAdd(combined, std::memory_order_relaxed);
+    if (SNUGINT_LIKELY(result.ok()))
+        return SnugIntError::None;
+
+    if (resolve && Policy::nothrow)
+    {   // the Policy decides what the total holds
+        total.fetch_add(combined, std::memory_order_relaxed);
+        return result.error;
+    }
+
+    slot.pending.fetch_add(pending, std::memory_order_relaxed);
+    if (resolve)
+        SnugInt<Type, Policy>::Resolve(SnugInt<Type, Policy>::TryAdd(result.value, combined));
+    return result.error;
+}
+
+/**
+ * \brief Merges every slot into the total
+ *
+ * \details
+ * The first failing slot stops the flush, it and the slots after it keep their pending counts
+ *
+ * @param resolve true to hand a failure to the Policy
+ * @return the error of the failed merge, None if every slot was merged
+ */
+template<class Type, class Policy, std::size_t Shards>
+SnugIntError SnugCounter<Type, Policy, Shards>::Flush(bool resolve) noexcept(Policy::nothrow)
+{
+    for (Slot& slot : slots)
+    {
+        if (slot.pending.load(std::memory_order_relaxed) == 0)
+            continue;
+        const SnugIntError error = Merge(slot, static_cast<Type>(0), resolve);
+        if (error != SnugIntError::None)
+            return error;
+    }
+    return SnugIntError::None;
+}
+
+/**
+ * \brief Sum of the total and every slot
+ *
+ * \details
+ * Exact when no add runs concurrently, an add racing the read may or may not be included. The sum is taken in
+ * a 128 bit accumulator and checked once, so slots of opposite signs never overflow on the way
+ *
+ * @return the count, or the wrapped count and its error
+ */
+template<class Type, class Policy, std::size_t Shards>
+SnugIntResult<Type> SnugCounter<Type, Policy, Shards>::TryExact() const noexcept
+{
+    typedef typename snug::detail::Widest<Type>::type Wide;
+    snug::detail::Accumulator sum = {0, 0};
+    sum.Add(static_cast<Wide>(total.load(std::memory_order_relaxed)));
+    for (const Slot& slot : slots)
+        sum.Add(static_cast<Wide>(slot.pending.load(std::memory_order_relaxed)));
+    return snug::detail::Narrow<Type>(sum, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow);
+}
@@ -0,0 +1,110 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGDIVISOR_H
+#define PROJECT_SNUGDIVISOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SnugInt.h"
+#include "SnugIntBatch.h"
+
+namespace snug
+{
+namespace detail
+{
+    // Unsigned word the magic number of a SnugDivisor<T> is computed in
+    template<class T>
+    struct DivisorWord
+    {
+        typedef typename std::conditional<(sizeof(T) <= 4), std::uint32_t, std::uint64_t>::type type;
+    };
+}
+}
+
+/**
+ * \brief Checked divisor with a precomputed reciprocal
+ *
+ * \details
+ * Dividing many values by the same divisor is dominated by the hardware div. A SnugDivisor
+ * checks the divisor once and precomputes a magic number and a shift (the round up method of
+ * Granlund and Montgomery, as used by libdivide), so every division is a high multiply, an
+ * add and a shift. Signed division is done on the magnitudes with branch free sign fix ups
+ * and truncates towards zero like the built in operator.
+ *
+ * \details
+ * - A zero divisor is handed to the Policy on construction and every division by it reports
+ *   DivisionByZero, min / -1 reports DivisionOverflow. Both cases are folded into one flag so
+ *   a division that can not fail costs a single compare
+ *
+ * \details
+ * - snug::div divides an array by a SnugDivisor and reports the first failing element
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugDivisor<long> lot = lot_size;          // checked once, throws on 0
+ *for (std::size_t i = 0; i < count; ++i)
+ *    lots[i] = SnugInt<long>(shares[i]) / lot;
+ * \endcode
+ * @tparam Type integer to do operations with
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+ */
+template<class Type, class Policy = SnugIntThrowPolicy>
+class SnugDivisor
+{
+    static_assert(std::is_integral<Type>::value, "SnugDivisor must be an integral");
+    static_assert(sizeof(Type) <= 8, "SnugDivisor supports integrals of up to 64 bits");
+public:
+    // Constructors
+    constexpr SnugDivisor(const Type& divisor) noexcept(Policy::nothrow);
+    constexpr SnugDivisor(const SnugInt<Type, Policy>& divisor) noexcept(Policy::nothrow);
+
+    // Non throwing Operations
+    constexpr SnugIntResult<Type> TryDiv(Type item) const noexcept;
+    constexpr SnugIntResult<Type> TryMod(Type item) const noexcept;
+
+    // Accessor Operators
+    constexpr Type getValue() const noexcept { return divisor; };
+
+    // Mathematical Operators (SnugInt, SnugDivisor) and (T, SnugDivisor)
+    template<class T, class P> friend constexpr SnugInt<T, P> operator/(const SnugInt<T, P>& left, const SnugDivisor<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator%(const SnugInt<T, P>& left, const SnugDivisor<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator/(const T& left, const SnugDivisor<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator%(const T& left, const SnugDivisor<T, P>& right) noexcept(P::nothrow);
+private:
+    typedef typename snug::detail::DivisorWord<Type>::type Word;
+
+    Type divisor;           /**< the divisor */
+    Word magnitude;         /**< |divisor| */
+    Word magic;             /**< magic number, 0 for a power of two */
+    unsigned char shift;    /**< shift after the high multiply */
+    bool add;               /**< the magic number needs the extra add of the round up method */
+    bool negative;          /**< divisor is negative */
+    bool checked;           /**< divisor is 0 or -1, some division can fail */
+
+    constexpr Word Divide(Word item) const noexcept;
+};
+
+namespace snug
+{
+    // Element wise division of an array by a SnugDivisor
+    template<class T, class P> BatchResult div(const T* left, const SnugDivisor<T, P>& right, T* out, std::size_t count) noexcept;
+}
+
+#include "SnugDivisor.tpp"
+
+#endif //PROJECT_SNUGDIVISOR_H
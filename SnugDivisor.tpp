@@ -0,0 +1,307 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include "SnugDivisor.h"
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief High half of the double width product of left and right
+     */
+    constexpr std::uint32_t MulHigh(std::uint32_t left, std::uint32_t right) noexcept
+    {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>(left) * right) >> 32);
+    }
+
+    constexpr std::uint64_t MulHigh(std::uint64_t left, std::uint64_t right) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<std::uint64_t>((static_cast<unsigned __int128>(left) * right) >> 64);
+#else
+        const std::uint64_t low = (left & 0xFFFFFFFFu) * (right & 0xFFFFFFFFu);
+        const std::uint64_t cross = (left >> 32) * (right & 0xFFFFFFFFu) + (low >> 32);
+        const std::uint64_t middle = (left & 0xFFFFFFFFu) * (right >> 32) + (cross & 0xFFFFFFFFu);
+        return (left >> 32) * (right >> 32) + (cross >> 32) + (middle >> 32);
+#endif
+    }
+
+    /**
+     * \brief floor(2^(32 + exponent) / divisor) and its remainder, divisor > 2^exponent
+     */
+    constexpr std::uint32_t MagicQuotient(std::uint32_t divisor, int exponent, std::uint32_t& remainder) noexcept
+    {
+        const std::uint64_t numerator = static_cast<std::uint64_t>(1) << (32 + exponent);
+        remainder = static_cast<std::uint32_t>(numerator % divisor);
+        return static_cast<std::uint32_t>(numerator / divisor);
+    }
+
+    /**
+     * \brief floor(2^(64 + exponent) / divisor) and its remainder, divisor > 2^exponent
+     */
+    constexpr std::uint64_t MagicQuotient(std::uint64_t divisor, int exponent, std::uint64_t& remainder) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 numerator = static_cast<unsigned __int128>(1) << (64 + exponent);
+        remainder = static_cast<std::uint64_t>(numerator % divisor);
+        return static_cast<std::uint64_t>(numerator / divisor);
+#else
+        // restoring division, the high word 2^exponent is already below divisor
+        std::uint64_t quotient = 0;
+        remainder = static_cast<std::uint64_t>(1) << exponent;
+        for (int bit = 63; bit >= 0; --bit)
+        {
+            const bool carry = (remainder >> 63) != 0;
+            remainder <<= 1;
+            if (carry || remainder >= divisor)
+            {
+                remainder -= divisor;
+                quotient |= static_cast<std::uint64_t>(1) << bit;
+            }
+        }
+        return quotient;
+#endif
+    }
+
+    // Index of the highest set bit of a non zero item
+    template<class Word>
+    constexpr int FloorLog2(Word item) noexcept
+    {
+        int log = 0;
+        while (item >>= 1)
+            ++log;
+        return log;
+    }
+
+    // All ones when negative is set, for branch free sign fix ups
+    template<class Word>
+    constexpr Word SignMask(bool negative) noexcept
+    {
+        return negative ? static_cast<Word>(~static_cast<Word>(0)) : static_cast<Word>(0);
+    }
+}
+}
+
+/**
+ * \brief SnugDivisor constructor
+ *
+ * \details
+ * Computes the magic number for |item|. A zero divisor is handed to the Policy as DivisionByZero,
+ * with a non throwing Policy the divisor is kept and every division by it fails
+ *
+ * @param item the divisor
+ */
+template<class Type, class Policy>
+constexpr SnugDivisor<Type, Policy>::SnugDivisor(const Type &item) noexcept(Policy::nothrow)
+        : divisor(item),
+          magnitude(static_cast<Word>((static_cast<Word>(item) ^ snug::detail::SignMask<Word>(snug::detail::IsNegative(item)))
+                                      - snug::detail::SignMask<Word>(snug::detail::IsNegative(item)))),
+          magic(0), shift(0), add(false), negative(snug::detail::IsNegative(item)),
+          checked(item == 0 || (std::is_signed<Type>::value && item == static_cast<Type>(-1)))
+{
+    if (item == 0)
+    {
+        SnugIntResult<Type> result = {0, SnugIntError::DivisionByZero};
+        SnugInt<Type, Policy>::Resolve(result);
+        return;
+    }
+
+    const int log = snug::detail::FloorLog2(magnitude);
+    shift = static_cast<unsigned char>(log);
+
+    if ((magnitude & (magnitude - 1)) == 0)
+        return; // power of two, a plain shift
+
+    Word remainder = 0;
+    Word proposed = snug::detail::MagicQuotient(magnitude, log, remainder);
+
+    if (static_cast<Word>(magnitude - remainder) >= (static_cast<Word>(1) << log))
+    {   // 2^(W + log) / divisor does not round up closely enough, use one more bit and the add fix up
+        proposed = static_cast<Word>(proposed + proposed);
+        const Word twice = static_cast<Word>(remainder + remainder);
+        if (twice >= magnitude || twice < remainder)
+            ++proposed;
+        add = true;
+    }
+
+    magic = static_cast<Word>(proposed + 1);
+}
+
+/**
+ * \brief SnugDivisor constructor from a SnugInt
+ */
+template<class Type, class Policy>
+constexpr SnugDivisor<Type, Policy>::SnugDivisor(const SnugInt<Type, Policy> &item) noexcept(Policy::nothrow)
+        : SnugDivisor(item.getValue())
+{
+}
+
+/**
+ * \brief Unsigned division of item by magnitude through the magic number
+ */
+template<class Type, class Policy>
+constexpr typename SnugDivisor<Type, Policy>::Word SnugDivisor<Type, Policy>::Divide(Word item) const noexcept
+{
+    if (magic == 0)
+        return static_cast<Word>(item >> shift);
+
+    const Word high = snug::detail::MulHigh(magic, item);
+    if (add)
+        return static_cast<Word>((static_cast<Word>(static_cast<Word>(item - high) >> 1) + high) >> shift);
+    return static_cast<Word>(high >> shift);
+}
+
+/**
+ * \brief Divides item by the divisor without throwing
+ *
+ * \details
+ * Same results and errors as SnugInt::TryDiv, DivisionByZero or DivisionOverflow for min / -1
+ *
+ * @param item value to be divided
+ * @return item / divisor
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugDivisor<Type, Policy>::TryDiv(Type item) const noexcept
+{
+    const Word sign = snug::detail::SignMask<Word>(snug::detail::IsNegative(item));
+    const Word quotient = Divide(static_cast<Word>((static_cast<Word>(item) ^ sign) - sign));
+    const Word quotient_sign = static_cast<Word>(sign ^ snug::detail::SignMask<Word>(negative));
+
+    SnugIntResult<Type> result = {static_cast<Type>((quotient ^ quotient_sign) - quotient_sign), SnugIntError::None};
+
+    if (checked)
+    {
+        if (divisor == 0)
+            result = {0, SnugIntError::DivisionByZero};
+        else if (item == std::numeric_limits<Type>::min())
+            result.error = SnugIntError::DivisionOverflow; // -min wraps to min itself
+    }
+
+    return snug::detail::Record(SnugIntOperation::Div, result);
+}
+
+/**
+ * \brief Remainder of item divided by the divisor without throwing
+ *
+ * \details
+ * Same results and errors as SnugInt::TryMod, the remainder has the sign of item
+ *
+ * @param item value to be divided
+ * @return item % divisor
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugDivisor<Type, Policy>::TryMod(Type item) const noexcept
+{
+    const Word sign = snug::detail::SignMask<Word>(snug::detail::IsNegative(item));
+    const Word dividend = static_cast<Word>((static_cast<Word>(item) ^ sign) - sign);
+    const Word remainder = static_cast<Word>(dividend - Divide(dividend) * magnitude);
+
+    SnugIntResult<Type> result = {static_cast<Type>((remainder ^ sign) - sign), SnugIntError::None};
+
+    if (checked && divisor == 0)
+        result = {0, SnugIntError::DivisionByZero};
+
+    return snug::detail::Record(SnugIntOperation::Div, result);
+}
+
+/**
+ * \brief SnugInt division operator overload (SnugInt, SnugDivisor)
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be divided
+ * @param right SnugDivisor to divide by
+ * @return division of left / right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator/(const SnugInt<T, P> &left, const SnugDivisor<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(right.TryDiv(left.getValue())));
+}
+
+/**
+ * \brief SnugInt remainder operator overload (SnugInt, SnugDivisor)
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be divided
+ * @param right SnugDivisor to divide by
+ * @return remainder of left / right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator%(const SnugInt<T, P> &left, const SnugDivisor<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(right.TryMod(left.getValue())));
+}
+
+/**
+ * \brief SnugInt division operator overload (T, SnugDivisor)
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be divided
+ * @param right SnugDivisor to divide by
+ * @return division of left / right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator/(const T &left, const SnugDivisor<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(right.TryDiv(left)));
+}
+
+/**
+ * \brief SnugInt remainder operator overload (T, SnugDivisor)
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be divided
+ * @param right SnugDivisor to divide by
+ * @return remainder of left / right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator%(const T &left, const SnugDivisor<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(right.TryMod(left)));
+}
+
+namespace snug
+{
+    /**
+     * \brief Divides every element of left by right
+     *
+     * \details
+     * Every element of out is written (wrapped on failure), the first failing element is reported.
+     * left and out may be the same array
+     *
+     * @param left array to be divided
+     * @param right the divisor
+     * @param out array receiving the quotients
+     * @param count number of elements
+     * @return the first failing element, or SnugIntError::None and count
+     */
+    template<class T, class P>
+    BatchResult div(const T* left, const SnugDivisor<T, P>& right, T* out, std::size_t count) noexcept
+    {
+        BatchResult result = {SnugIntError::None, count};
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const SnugIntResult<T> item = right.TryDiv(left[i]);
+            out[i] = item.value;
+            if (!item.ok() && result.ok())
+                result = {item.error, i};
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,203 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGFIXED_H
+#define PROJECT_SNUGFIXED_H
+
+#include "SnugInt.h"
+#include "SnugWide.h"
+
+/**
+ * \brief SnugFixed rounding policies
+ *
+ * \details
+ * The Rounding parameter of SnugScaled decides how a rescaled result that falls between two
+ * representable values is rounded. A rounding policy provides
+ * \code
+ *static constexpr bool Up(bool negative, unsigned long long quotient, unsigned long long remainder,
+ *                         unsigned long long divisor);
+ * \endcode
+ * which is given the truncated magnitude of the result, the remainder and the divisor it came from,
+ * and returns true when the magnitude should be rounded up by one.
+ */
+
+/**
+ * \brief Truncates towards zero, like integer division
+ */
+struct SnugRoundTruncate
+{
+    static constexpr bool Up(bool, unsigned long long, unsigned long long, unsigned long long) noexcept
+    {
+        return false;
+    }
+};
+
+/**
+ * \brief Rounds towards negative infinity
+ */
+struct SnugRoundFloor
+{
+    static constexpr bool Up(bool negative, unsigned long long, unsigned long long remainder, unsigned long long) noexcept
+    {
+        return negative && remainder != 0;
+    }
+};
+
+/**
+ * \brief Rounds towards positive infinity
+ */
+struct SnugRoundCeil
+{
+    static constexpr bool Up(bool negative, unsigned long long, unsigned long long remainder, unsigned long long) noexcept
+    {
+        return !negative && remainder != 0;
+    }
+};
+
+/**
+ * \brief Rounds to nearest, halves away from zero, the default
+ */
+struct SnugRoundHalfAway
+{
+    static constexpr bool Up(bool, unsigned long long, unsigned long long remainder, unsigned long long divisor) noexcept
+    {
+        return remainder >= divisor - remainder;
+    }
+};
+
+/**
+ * \brief Rounds to nearest, halves to even (banker's rounding)
+ */
+struct SnugRoundHalfEven
+{
+    static constexpr bool Up(bool, unsigned long long quotient, unsigned long long remainder, unsigned long long divisor) noexcept
+    {
+        return remainder > divisor - remainder || (remainder == divisor - remainder && (quotient & 1u) != 0);
+    }
+};
+
+/**
+ * \brief Checked fixed point number, a raw integer in units of 1 / Unit
+ *
+ * \details
+ * Addition and subtraction are the checked SnugInt operations on the raw values. Multiplication and
+ * division work on the magnitudes in 128 bits: the double width product (or the dividend times Unit)
+ * is rescaled and rounded once, and the result gets a single range check. A power of two Unit
+ * rescales with a shift, any other Unit with one 128 by 64 bit division.
+ *
+ * \details
+ * - Use the aliases, SnugFixed<T, FracBits> for binary fractions (Q15, Q31) and
+ *   SnugDecimal<T, Digits> for decimal ones (prices in 1e-8)
+ *
+ * \details
+ * - Integers convert implicitly and are checked, a value whose scaled form does not fit is handed to
+ *   the Policy as a MultiplicationOverflow / MultiplicationUnderflow
+ *
+ * \details
+ * - Division by zero reports DivisionByZero, a quotient that does not fit DivisionOverflow / DivisionUnderflow
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *typedef SnugDecimal<std::int64_t, 8> Price;
+ *Price total = Price::fromRaw(quote) * quantity;   // two checks, quantity scaled to a Price and one widened multiply
+ *SnugFixed<std::int32_t, 31, SnugRoundHalfEven> gain = SnugFixed<std::int32_t, 31>::fromRaw(raw);
+ * \endcode
+ * @tparam Type integer the raw value is stored in
+ * @tparam Unit raw value of 1, at most 2^digits of Type
+ * @tparam Rounding how rescaled results are rounded, one of the rounding policies above
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+ */
+template<class Type, unsigned long long Unit, class Rounding = SnugRoundHalfAway, class Policy = SnugIntThrowPolicy>
+class SnugScaled
+{
+    static_assert(snug::detail::IsInteger<Type>::value, "SnugScaled must be an integral");
+    static_assert(sizeof(Type) <= 8, "SnugScaled supports integrals of up to 64 bits");
+    static_assert(Unit > 0 && Unit - 1 <= static_cast<unsigned long long>(std::numeric_limits<Type>::max()),
+                  "SnugScaled needs a Unit between 1 and 2^digits of Type");
+public:
+    static constexpr unsigned long long unit = Unit; /**< raw value of 1 */
+
+    // Constructors
+    constexpr SnugScaled() noexcept : value(0) {};
+    template<class T, class = typename std::enable_if<snug::detail::IsInteger<T>::value && (sizeof(T) <= 8)>::type>
+    constexpr SnugScaled(T item) noexcept(Policy::nothrow);
+    template<class T, class P>
+    constexpr SnugScaled(const SnugInt<T, P>& item) noexcept(Policy::nothrow) : SnugScaled(item.getValue()) {};
+    static constexpr SnugScaled fromRaw(Type raw) noexcept;
+
+    // Accessor Operators
+    constexpr Type getRaw() const noexcept { return value; };
+    constexpr Type toInteger() const noexcept;
+    constexpr double toDouble() const noexcept { return static_cast<double>(value) / static_cast<double>(Unit); };
+
+    // Non throwing Operations, the results are raw values
+    template<class T> static constexpr SnugIntResult<Type> TryFrom(T item) noexcept;
+    static constexpr SnugIntResult<Type> TryAdd(const SnugScaled& left, const SnugScaled& right) noexcept;
+    static constexpr SnugIntResult<Type> TrySub(const SnugScaled& left, const SnugScaled& right) noexcept;
+    static constexpr SnugIntResult<Type> TryMult(const SnugScaled& left, const SnugScaled& right) noexcept;
+    static constexpr SnugIntResult<Type> TryDiv(const SnugScaled& left, const SnugScaled& right) noexcept;
+    static constexpr SnugIntResult<Type> TryNegate(const SnugScaled& item) noexcept;
+
+    // Assignment Operators
+    constexpr SnugScaled& operator += (const SnugScaled& other) noexcept(Policy::nothrow) { return *this = Resolve(TryAdd(*this, other)); };
+    constexpr SnugScaled& operator -= (const SnugScaled& other) noexcept(Policy::nothrow) { return *this = Resolve(TrySub(*this, other)); };
+    constexpr SnugScaled& operator *= (const SnugScaled& other) noexcept(Policy::nothrow) { return *this = Resolve(TryMult(*this, other)); };
+    constexpr SnugScaled& operator /= (const SnugScaled& other) noexcept(Policy::nothrow) { return *this = Resolve(TryDiv(*this, other)); };
+
+    // Mathematical Operators, found through the SnugScaled operand so an integer on the other side converts
+    friend constexpr SnugScaled operator + (const SnugScaled& left, const SnugScaled& right) noexcept(Policy::nothrow) { return Resolve(TryAdd(left, right)); };
+    friend constexpr SnugScaled operator - (const SnugScaled& left, const SnugScaled& right) noexcept(Policy::nothrow) { return Resolve(TrySub(left, right)); };
+    friend constexpr SnugScaled operator * (const SnugScaled& left, const SnugScaled& right) noexcept(Policy::nothrow) { return Resolve(TryMult(left, right)); };
+    friend constexpr SnugScaled operator / (const SnugScaled& left, const SnugScaled& right) noexcept(Policy::nothrow) { return Resolve(TryDiv(left, right)); };
+    friend constexpr SnugScaled operator - (const SnugScaled& item) noexcept(Policy::nothrow) { return Resolve(TryNegate(item)); };
+
+    // Comparison Operators
+    friend constexpr bool operator == (const SnugScaled& left, const SnugScaled& right) noexcept { return left.value == right.value; };
+    friend constexpr bool operator != (const SnugScaled& left, const SnugScaled& right) noexcept { return left.value != right.value; };
+    friend constexpr bool operator < (const SnugScaled& left, const SnugScaled& right) noexcept { return left.value < right.value; };
+    friend constexpr bool operator > (const SnugScaled& left, const SnugScaled& right) noexcept { return left.value > right.value; };
+    friend constexpr bool operator <= (const SnugScaled& left, const SnugScaled& right) noexcept { return left.value <= right.value; };
+    friend constexpr bool operator >= (const SnugScaled& left, const SnugScaled& right) noexcept { return left.value >= right.value; };
+private:
+    Type value; /**< raw value, the number times Unit */
+
+    static constexpr SnugScaled Resolve(const SnugIntResult<Type>& result) noexcept(Policy::nothrow);
+};
+
+// Binary fixed point with FracBits fraction bits, Q15 is SnugFixed<std::int16_t, 15>
+template<class Type, unsigned FracBits, class Rounding = SnugRoundHalfAway, class Policy = SnugIntThrowPolicy>
+using SnugFixed = SnugScaled<Type, (1ull << FracBits), Rounding, Policy>;
+
+namespace snug
+{
+namespace detail
+{
+    // 10^digits
+    constexpr unsigned long long FixedPower(unsigned digits) noexcept
+    {
+        return digits == 0 ? 1ull : 10ull * FixedPower(digits - 1);
+    }
+}
+}
+
+// Decimal fixed point with Digits fraction digits, prices in 1e-8 are SnugDecimal<std::int64_t, 8>
+template<class Type, unsigned Digits, class Rounding = SnugRoundHalfAway, class Policy = SnugIntThrowPolicy>
+using SnugDecimal = SnugScaled<Type, snug::detail::FixedPower(Digits), Rounding, Policy>;
+
+#include "SnugFixed.tpp"
+
+#endif //PROJECT_SNUGFIXED_H
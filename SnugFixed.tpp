@@ -0,0 +1,280 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include "SnugFixed.h"
+
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr unsigned long long SnugScaled<Type, Unit, Rounding, Policy>::unit;
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief |item| as 64 bits, exact for min
+     */
+    template<class T>
+    constexpr unsigned long long FixedMagnitude(T item) noexcept
+    {
+        return IsNegative(item) ? 0ull - static_cast<unsigned long long>(item) : static_cast<unsigned long long>(item);
+    }
+
+    /**
+     * \brief Rounds a truncated quotient by Rounding
+     *
+     * @return false when rounding up carries out of 64 bits
+     */
+    template<class Rounding>
+    constexpr bool FixedRound(unsigned long long remainder, unsigned long long divisor, bool negative,
+                              unsigned long long* quotient) noexcept
+    {
+        if (!Rounding::Up(negative, *quotient, remainder, divisor))
+            return true;
+        return ++*quotient != 0;
+    }
+
+    /**
+     * \brief Rounded high:low / divisor
+     *
+     * @return false when the quotient does not fit in 64 bits
+     */
+    template<class Rounding>
+    constexpr bool FixedDivide(unsigned long long high, unsigned long long low, unsigned long long divisor, bool negative,
+                               unsigned long long* quotient) noexcept
+    {
+        if (high >= divisor)
+            return false;
+
+        unsigned long long remainder = 0;
+        *quotient = DivStep(high, low, divisor, &remainder);
+        return FixedRound<Rounding>(remainder, divisor, negative, quotient);
+    }
+
+    // log2 of a power of two
+    constexpr unsigned FixedLog2(unsigned long long item) noexcept
+    {
+        return item <= 1 ? 0 : 1 + FixedLog2(item >> 1);
+    }
+
+    /**
+     * \brief Rounded high:low / Unit, a shift when Unit is a power of two
+     *
+     * @return false when the quotient does not fit in 64 bits
+     */
+    template<class Rounding, unsigned long long Unit>
+    constexpr bool FixedRescale(unsigned long long high, unsigned long long low, bool negative,
+                                unsigned long long* quotient) noexcept
+    {
+        if ((Unit & (Unit - 1)) != 0)
+            return FixedDivide<Rounding>(high, low, Unit, negative, quotient);
+
+        constexpr unsigned shift = FixedLog2(Unit);
+        if (high >= Unit)
+            return false;
+
+        *quotient = shift == 0 ? low : (high << ((64 - shift) & 63)) | (low >> shift);
+        return FixedRound<Rounding>(low & (Unit - 1), Unit, negative, quotient);
+    }
+
+    /**
+     * \brief Range checks a magnitude and sign against T
+     *
+     * @param magnitude magnitude of the result
+     * @param negative sign of the result
+     * @param fits false when the magnitude was already lost
+     * @param overflow error reported when the result is above the max of T
+     * @param underflow error reported when the result is below the min of T
+     * @return the result as T, or overflow / underflow with the wrapped value
+     */
+    template<class T>
+    constexpr SnugIntResult<T> FixedNarrow(unsigned long long magnitude, bool negative, bool fits,
+                                           SnugIntError overflow, SnugIntError underflow) noexcept
+    {
+        const unsigned long long limit = negative ? (IsSigned<T>::value ? static_cast<unsigned long long>(std::numeric_limits<T>::max()) + 1 : 0)
+                                                  : static_cast<unsigned long long>(std::numeric_limits<T>::max());
+        SnugIntResult<T> result = {static_cast<T>(negative ? 0ull - magnitude : magnitude), SnugIntError::None};
+        if (!fits || magnitude > limit)
+            result.error = negative ? underflow : overflow;
+        return result;
+    }
+}
+}
+
+/**
+ * \brief SnugScaled constructor (T)
+ *
+ * \details
+ * a <b>SNUGINT_MULT_EXCEPTION</b> will be thrown if item times Unit does not fit in Type
+ *
+ * @tparam T integral type of item
+ * @param item integer value
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+template<class T, class>
+constexpr SnugScaled<Type, Unit, Rounding, Policy>::SnugScaled(T item) noexcept(Policy::nothrow)
+    : value(SnugInt<Type, Policy>::Resolve(TryFrom(item)))
+{
+}
+
+/**
+ * \brief SnugScaled from a raw value, the number times Unit
+ *
+ * @param raw raw value
+ * @return the SnugScaled holding raw
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr SnugScaled<Type, Unit, Rounding, Policy> SnugScaled<Type, Unit, Rounding, Policy>::fromRaw(Type raw) noexcept
+{
+    SnugScaled result;
+    result.value = raw;
+    return result;
+}
+
+/**
+ * \brief Integer part, rounded by Rounding
+ *
+ * @return the value rounded to an integer, always fits in Type
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr Type SnugScaled<Type, Unit, Rounding, Policy>::toInteger() const noexcept
+{
+    const bool negative = snug::detail::IsNegative(value);
+    unsigned long long quotient = 0;
+    snug::detail::FixedRescale<Rounding, Unit>(0, snug::detail::FixedMagnitude(value), negative, &quotient);
+    return static_cast<Type>(negative ? 0ull - quotient : quotient);
+}
+
+/**
+ * \brief Scales an integer without throwing
+ *
+ * @tparam T integral type of item
+ * @param item integer value
+ * @return the raw value item times Unit, or MultiplicationOverflow / MultiplicationUnderflow
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+template<class T>
+constexpr SnugIntResult<Type> SnugScaled<Type, Unit, Rounding, Policy>::TryFrom(T item) noexcept
+{
+    unsigned long long high = 0;
+    const unsigned long long low = snug::detail::MulAdd(snug::detail::FixedMagnitude(item), Unit, 0, &high);
+    return snug::detail::Record(SnugIntOperation::Mult,
+                                snug::detail::FixedNarrow<Type>(low, snug::detail::IsNegative(item), high == 0,
+                                                                SnugIntError::MultiplicationOverflow,
+                                                                SnugIntError::MultiplicationUnderflow));
+}
+
+/**
+ * \brief Adds two SnugScaleds without throwing
+ *
+ * @param left value to be added to right
+ * @param right value to be added to left
+ * @return the raw sum, or AdditionOverflow / AdditionUnderflow
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr SnugIntResult<Type> SnugScaled<Type, Unit, Rounding, Policy>::TryAdd(const SnugScaled& left, const SnugScaled& right) noexcept
+{
+    return SnugInt<Type, SnugIntWrapPolicy>::TryAdd(left.value, right.value);
+}
+
+/**
+ * \brief Subtracts two SnugScaleds without throwing
+ *
+ * @param left value to be subtracted from
+ * @param right value to subtract
+ * @return the raw difference, or SubtractionOverflow / SubtractionUnderflow
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr SnugIntResult<Type> SnugScaled<Type, Unit, Rounding, Policy>::TrySub(const SnugScaled& left, const SnugScaled& right) noexcept
+{
+    return SnugInt<Type, SnugIntWrapPolicy>::TrySub(left.value, right.value);
+}
+
+/**
+ * \brief Multiplies two SnugScaleds without throwing
+ *
+ * \details
+ * The magnitudes are multiplied into 128 bits and rescaled by Unit with one rounding,
+ * the result is range checked once
+ *
+ * @param left value to be multiplied
+ * @param right value to be multiplied
+ * @return the raw product, or MultiplicationOverflow / MultiplicationUnderflow
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr SnugIntResult<Type> SnugScaled<Type, Unit, Rounding, Policy>::TryMult(const SnugScaled& left, const SnugScaled& right) noexcept
+{
+    const bool negative = snug::detail::IsNegative(left.value) != snug::detail::IsNegative(right.value);
+    unsigned long long high = 0;
+    const unsigned long long low = snug::detail::MulAdd(snug::detail::FixedMagnitude(left.value),
+                                                        snug::detail::FixedMagnitude(right.value), 0, &high);
+    unsigned long long quotient = 0;
+    const bool fits = snug::detail::FixedRescale<Rounding, Unit>(high, low, negative, &quotient);
+    return snug::detail::Record(SnugIntOperation::Mult,
+                                snug::detail::FixedNarrow<Type>(quotient, negative, fits,
+                                                                SnugIntError::MultiplicationOverflow,
+                                                                SnugIntError::MultiplicationUnderflow));
+}
+
+/**
+ * \brief Divides two SnugScaleds without throwing
+ *
+ * \details
+ * The magnitude of left times Unit is divided in 128 bits with one rounding, the result is
+ * range checked once
+ *
+ * @param left value to be divided
+ * @param right value to divide by
+ * @return the raw quotient, or DivisionByZero, DivisionOverflow / DivisionUnderflow
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr SnugIntResult<Type> SnugScaled<Type, Unit, Rounding, Policy>::TryDiv(const SnugScaled& left, const SnugScaled& right) noexcept
+{
+    if (right.value == 0)
+        return snug::detail::Record(SnugIntOperation::Div, SnugIntResult<Type>{0, SnugIntError::DivisionByZero});
+
+    const bool negative = snug::detail::IsNegative(left.value) != snug::detail::IsNegative(right.value);
+    unsigned long long high = 0;
+    const unsigned long long low = snug::detail::MulAdd(snug::detail::FixedMagnitude(left.value), Unit, 0, &high);
+    unsigned long long quotient = 0;
+    const bool fits = snug::detail::FixedDivide<Rounding>(high, low, snug::detail::FixedMagnitude(right.value),
+                                                          negative, &quotient);
+    return snug::detail::Record(SnugIntOperation::Div,
+                                snug::detail::FixedNarrow<Type>(quotient, negative, fits,
+                                                                SnugIntError::DivisionOverflow,
+                                                                SnugIntError::DivisionUnderflow));
+}
+
+/**
+ * \brief Negates a SnugScaled without throwing
+ *
+ * @param item value to negate
+ * @return the raw negation, or NegationOverflow / NegationUnderflow
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr SnugIntResult<Type> SnugScaled<Type, Unit, Rounding, Policy>::TryNegate(const SnugScaled& item) noexcept
+{
+    return SnugInt<Type, SnugIntWrapPolicy>::TryNegate(item.value);
+}
+
+/**
+ * \brief Resolves a raw SnugIntResult through the Policy, as SnugInt does
+ */
+template<class Type, unsigned long long Unit, class Rounding, class Policy>
+constexpr SnugScaled<Type, Unit, Rounding, Policy> SnugScaled<Type, Unit, Rounding, Policy>::Resolve(const SnugIntResult<Type>& result) noexcept(Policy::nothrow)
+{
+    return fromRaw(SnugInt<Type, Policy>::Resolve(result));
+}
@@ -12,4 +12,18 @@ distributed under the License is distributed on an "AS IS" BASIS,
 WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
         limitations under the License.
-*/
\ No newline at end of file
+*/
+#include "SnugInt.h"
+
+// Definitions of the instantiations SNUGINT_EXTERN_TEMPLATES declares in SnugInt.h
+template class SnugInt<char>;
+template class SnugInt<signed char>;
+template class SnugInt<unsigned char>;
+template class SnugInt<short>;
+template class SnugInt<unsigned short>;
+template class SnugInt<int>;
+template class SnugInt<unsigned int>;
+template class SnugInt<long>;
+template class SnugInt<unsigned long>;
+template class SnugInt<long long>;
+template class SnugInt<unsigned long long>;
@@ -17,9 +17,65 @@ See the License for the specific language governing permissions and
 #ifndef PROJECT_SNUGINT_H
 #define PROJECT_SNUGINT_H
 
+#include <climits>
+#include <cstdlib>
 #include <exception>
-#include <iostream>
+#include <istream>
 #include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include "SnugIntBackend.h"
+
+/**
+ * \brief SnugInt error codes
+ *
+ * \details
+ * Returned by the non throwing Try methods, each code matches one of the SnugInt exceptions
+ * so a call site can switch between the two styles without losing information.
+ */
+enum class SnugIntError
+{
+    None,                   /**< operation succeeded */
+    AdditionOverflow,       /**< SnugInt_Addition_Overflow_Exception */
+    AdditionUnderflow,      /**< SnugInt_Addition_Underflow_Exception */
+    SubtractionOverflow,    /**< SnugInt_Subtraction_Overflow_Exception */
+    SubtractionUnderflow,   /**< SnugInt_Subtraction_Underflow_Exception */
+    MultiplicationOverflow, /**< SnugInt_Multiplication_Overflow_Exception */
+    MultiplicationUnderflow,/**< SnugInt_Multiplication_Underflow_Exception */
+    SizeMismatch,           /**< SnugInt_Size_Mismatch_Exception */
+    TypeMismatch,           /**< SnugInt_Type_Mismatch_Exception */
+    DivisionByZero,         /**< SnugInt_Division_By_Zero_Exception */
+    DivisionOverflow,       /**< SnugInt_Division_Overflow_Exception */
+    DivisionUnderflow,      /**< SnugInt_Division_Underflow_Exception */
+    ShiftOutOfRange,        /**< SnugInt_Shift_Range_Exception */
+    ShiftOverflow,          /**< SnugInt_Shift_Overflow_Exception */
+    ShiftUnderflow,         /**< SnugInt_Shift_Underflow_Exception */
+    NegationOverflow,       /**< SnugInt_Negation_Overflow_Exception */
+    NegationUnderflow,      /**< SnugInt_Negation_Underflow_Exception */
+    InvalidFormat           /**< SnugInt_Invalid_Format_Exception */
+};
+
+/**
+ * \brief Result of a non throwing SnugInt operation
+ *
+ * \details
+ * Holds the value and the error of the operation. When error is not SnugIntError::None
+ * value holds the wrapped (two's complement) result and should not be trusted.
+ *
+ * @tparam Type integer type of the value
+ */
+template <class Type>
+struct SnugIntResult
+{
+    Type value;         /**< result of the operation */
+    SnugIntError error; /**< SnugIntError::None on success */
+
+    constexpr bool ok() const noexcept { return error == SnugIntError::None; };
+    constexpr explicit operator bool() const noexcept { return ok(); };
+};
+
+struct SnugIntThrowPolicy;
 
 /**
  * \brief SnugInt class for safe Integer operations
@@ -35,6 +91,29 @@ See the License for the specific language governing permissions and
  * \details
  * - Assignment for the class accepts all types but requires the type to be a Duck Type of integrals
  *
+ * \details
+ * - Operands of other integral types (SnugInt<int> + long, SnugInt<unsigned> - SnugInt<int>) are checked
+ *   exactly against Type. The cheapest check is picked at compile time (a mixed type builtin, or one
+ *   range check after widening) and no converting temporary is created
+ *
+ * \details
+ * - Shifts are checked (count in [0, width of Type), no set bit or sign lost on a left shift) with
+ *   branch free masks, bitwise operators are not checked and cost nothing over the raw operator
+ *
+ * \details
+ * - Every checked operation has a non throwing Try form (TryAdd, TrySub, TryMult, TryDiv, TryMod,
+ *   TryNegate, TryAbs, TryShiftLeft, TryShiftRight, TryFrom) returning
+ *   a SnugIntResult, the operators are built on top of them and throw the matching exception
+ *
+ * \details
+ * - Construction, arithmetic and comparisons are constexpr, a failing operation in a constant expression
+ *   is a compile error
+ *
+ * \details
+ * - A SnugInt has exactly the size and alignment of Type and is trivially copyable, the bounds are
+ *   compile time constants taken from std::numeric_limits. Arrays of Type can be memcpy'd into
+ *   arrays of SnugInt (and back) without any conversion.
+ *
  * \section <b>Exceptions:</b>
  * <br>The following exceptions are supported
  * \code
@@ -61,6 +140,33 @@ See the License for the specific language governing permissions and
  *
  *SnugInt_Type_Mismatch_Exception
  *    called when an unsupported type is used during assignment
+ *
+ *SnugInt_Division_By_Zero_Exception
+ *    called when a division or remainder by zero is detected
+ *
+ *SnugInt_Division_Overflow_Exception
+ *    called when overflow during division (min / -1) is predicted
+ *
+ *SnugInt_Division_Underflow_Exception
+ *    called when underflow during a mixed type division is predicted
+ *
+ *SnugInt_Shift_Range_Exception
+ *    called when a shift count is negative or not less than the width of Type
+ *
+ *SnugInt_Shift_Overflow_Exception
+ *    called when a left shift would push set bits out of a positive value
+ *
+ *SnugInt_Shift_Underflow_Exception
+ *    called when a left shift would push bits out of a negative value
+ *
+ *SnugInt_Negation_Overflow_Exception
+ *    called when negating (or taking abs of) the min of a signed Type
+ *
+ *SnugInt_Negation_Underflow_Exception
+ *    called when negating a non zero unsigned value
+ *
+ *SnugInt_Invalid_Format_Exception
+ *    called when snug::from_chars finds no decimal number in the text
  * \endcode
  *
  * \section <b>Example Usage:</b>
@@ -76,93 +182,242 @@ See the License for the specific language governing permissions and
  *}
  * \endcode
  * @tparam Type integer to do operations with
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
  *
  * \author Stephen Tafoya
  * \date 3/10/2019
  */
-template <class Type>
+template <class Type, class Policy = SnugIntThrowPolicy>
 class SnugInt
 {
-    static_assert(std::is_integral<Type>::value, "SnugInt must be an integral");
+    static_assert(snug::detail::IsInteger<Type>::value, "SnugInt must be an integral");
 public:
     // Constructors
-    SnugInt();
-    SnugInt(const SnugInt<Type> &other);
-    template<class T> SnugInt(const T &item);
+    constexpr SnugInt() noexcept;
+    constexpr SnugInt(const SnugInt &other) = default;
+    template<class T, class = typename std::enable_if<snug::detail::IsInteger<T>::value>::type>
+    constexpr SnugInt(const T &item) noexcept(Policy::nothrow);
 
     // Assignment Operators
-    SnugInt& operator = (const SnugInt& other);
-    SnugInt& operator = (const Type& other);
-    SnugInt& operator += (const SnugInt& other);
-    SnugInt& operator += (const Type& other);
+    SnugInt& operator = (const SnugInt& other) = default;
+    constexpr SnugInt& operator = (const Type& other) noexcept;
+    constexpr SnugInt& operator += (const SnugInt& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator += (const Type& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator -= (const SnugInt& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator -= (const Type& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator *= (const SnugInt& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator *= (const Type& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator /= (const SnugInt& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator /= (const Type& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator %= (const SnugInt& other) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator %= (const Type& other) noexcept(Policy::nothrow);
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator += (const U& other) noexcept(Policy::nothrow);
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator -= (const U& other) noexcept(Policy::nothrow);
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator *= (const U& other) noexcept(Policy::nothrow);
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator /= (const U& other) noexcept(Policy::nothrow);
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator %= (const U& other) noexcept(Policy::nothrow);
+    template<class T> constexpr SnugInt& operator <<= (const T& shift) noexcept(Policy::nothrow);
+    template<class T> constexpr SnugInt& operator >>= (const T& shift) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator &= (const SnugInt& other) noexcept;
+    constexpr SnugInt& operator &= (const Type& other) noexcept;
+    constexpr SnugInt& operator |= (const SnugInt& other) noexcept;
+    constexpr SnugInt& operator |= (const Type& other) noexcept;
+    constexpr SnugInt& operator ^= (const SnugInt& other) noexcept;
+    constexpr SnugInt& operator ^= (const Type& other) noexcept;
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator &= (const U& other) noexcept(Policy::nothrow);
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator |= (const U& other) noexcept(Policy::nothrow);
+    template<class U> constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt&> operator ^= (const U& other) noexcept(Policy::nothrow);
+
+    // Non throwing Operations
+    static constexpr SnugIntResult<Type> TryAdd(const SnugInt& left, const SnugInt& right) noexcept;
+    static constexpr SnugIntResult<Type> TrySub(const SnugInt& left, const SnugInt& right) noexcept;
+    static constexpr SnugIntResult<Type> TryMult(const SnugInt& left, const SnugInt& right) noexcept;
+    static constexpr SnugIntResult<Type> TryDiv(const SnugInt& left, const SnugInt& right) noexcept;
+    static constexpr SnugIntResult<Type> TryAdd(Type left, Type right) noexcept;
+    static constexpr SnugIntResult<Type> TrySub(Type left, Type right) noexcept;
+    static constexpr SnugIntResult<Type> TryMult(Type left, Type right) noexcept;
+    static constexpr SnugIntResult<Type> TryDiv(Type left, Type right) noexcept;
+    static constexpr SnugIntResult<Type> TryMod(const SnugInt& left, const SnugInt& right) noexcept;
+    static constexpr SnugIntResult<Type> TryMod(Type left, Type right) noexcept;
+    static constexpr SnugIntResult<Type> TryNegate(Type item) noexcept;
+    static constexpr SnugIntResult<Type> TryAbs(Type item) noexcept;
+    template<class T> static constexpr SnugIntResult<Type> TryShiftLeft(Type item, const T& shift) noexcept;
+    template<class T> static constexpr SnugIntResult<Type> TryShiftRight(Type item, const T& shift) noexcept;
+    template<class T> static constexpr SnugIntResult<Type> TryFrom(const T& item) noexcept;
+
+    // Non throwing Operations of mixed width or signedness, the exact result is checked against Type
+    template<class L, class R> static constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> TryAdd(L left, R right) noexcept;
+    template<class L, class R> static constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> TrySub(L left, R right) noexcept;
+    template<class L, class R> static constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> TryMult(L left, R right) noexcept;
+    template<class L, class R> static constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> TryDiv(L left, R right) noexcept;
+    template<class L, class R> static constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> TryMod(L left, R right) noexcept;
+
+    // Hands a failed result to the Policy
+    static constexpr Type Resolve(const SnugIntResult<Type>& result) noexcept(Policy::nothrow);
+    static constexpr Type Resolve(const SnugIntResult<Type>& result, Type saturated) noexcept(Policy::nothrow);
 
     // Accessor Operators
-    Type getValue() { return value; };
+    constexpr Type getValue() const noexcept { return value; };
 
     // Mathematical Operators (SnugInt, SnugInt)
-    template<class T> friend SnugInt<T> operator+(const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend SnugInt<T> operator-(const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend SnugInt<T> operator*(const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend SnugInt<T> operator/(const SnugInt<T>& left, const SnugInt<T>& right);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator+(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator-(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator*(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator/(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator%(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
 
 
     // Mathematical Operators (SnugInt, T)
-    template<class T> friend SnugInt<T> operator+(const SnugInt<T>& left, const T& right);
-    template<class T> friend SnugInt<T> operator-(const SnugInt<T>& left, const T& right);
-    template<class T> friend SnugInt<T> operator*(const SnugInt<T>& left, const T& right);
-    template<class T> friend SnugInt<T> operator/(const SnugInt<T>& left, const T& right);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator+(const SnugInt<T, P>& left, const T& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator-(const SnugInt<T, P>& left, const T& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator*(const SnugInt<T, P>& left, const T& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator/(const SnugInt<T, P>& left, const T& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator%(const SnugInt<T, P>& left, const T& right) noexcept(P::nothrow);
 
     // Mathematical Operators (T, SnugInt)
-    template<class T> friend SnugInt<T> operator+(const T& left, const SnugInt<T>& right);
-    template<class T> friend SnugInt<T> operator-(const T& left, const SnugInt<T>& right);
-    template<class T> friend SnugInt<T> operator*(const T& left, const SnugInt<T>& right);
-    template<class T> friend SnugInt<T> operator/(const T& left, const SnugInt<T>& right);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator+(const T& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator-(const T& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator*(const T& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator/(const T& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+    template<class T, class P> friend constexpr SnugInt<T, P> operator%(const T& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+
+    // Bitwise Operators (SnugInt, SnugInt), (SnugInt, T) and (T, SnugInt)
+    template<class T, class P> friend constexpr SnugInt<T, P> operator&(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator|(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator^(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator&(const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator|(const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator^(const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator&(const T& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator|(const T& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr SnugInt<T, P> operator^(const T& left, const SnugInt<T, P>& right) noexcept;
+
+    // Unary Operators
+    constexpr SnugInt operator-() const noexcept(Policy::nothrow);
+    constexpr SnugInt operator+() const noexcept { return *this; };
+    constexpr SnugInt operator~() const noexcept { return SnugInt(RawTag(), static_cast<Type>(~value)); };
 
     // Incremental & Decremental Operators
-    SnugInt& operator++();
-    const SnugInt operator++( int );
-    SnugInt& operator--();
-    const SnugInt operator--( int );
+    constexpr SnugInt& operator++() noexcept(Policy::nothrow);
+    constexpr const SnugInt operator++( int ) noexcept(Policy::nothrow);
+    constexpr SnugInt& operator--() noexcept(Policy::nothrow);
+    constexpr const SnugInt operator--( int ) noexcept(Policy::nothrow);
 
     // Comparison Operators (SnugInt, SnugInt)
-    template<class T> friend bool operator< (const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend bool operator> (const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend bool operator==(const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend bool operator!=(const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend bool operator>=(const SnugInt<T>& left, const SnugInt<T>& right);
-    template<class T> friend bool operator<=(const SnugInt<T>& left, const SnugInt<T>& right);
+    template<class T, class P> friend constexpr bool operator< (const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator> (const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator==(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator!=(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator>=(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator<=(const SnugInt<T, P>& left, const SnugInt<T, P>& right) noexcept;
 
     // Comparison Operators (SnugInt, T)
-    template<class T> friend bool operator< (const SnugInt<T>& left, const T& right);
-    template<class T> friend bool operator> (const SnugInt<T>& left, const T& right);
-    template<class T> friend bool operator==(const SnugInt<T>& left, const T& right);
-    template<class T> friend bool operator!=(const SnugInt<T>& left, const T& right);
-    template<class T> friend bool operator>=(const SnugInt<T>& left, const T& right);
-    template<class T> friend bool operator<=(const SnugInt<T>& left, const T& right);
+    template<class T, class P> friend constexpr bool operator< (const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr bool operator> (const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr bool operator==(const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr bool operator!=(const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr bool operator>=(const SnugInt<T, P>& left, const T& right) noexcept;
+    template<class T, class P> friend constexpr bool operator<=(const SnugInt<T, P>& left, const T& right) noexcept;
 
     // Comparison Operators (T, SnugInt)
-    template<class T> friend bool operator< (const T& left, const SnugInt<T>& right);
-    template<class T> friend bool operator> (const T& left, const SnugInt<T>& right);
-    template<class T> friend bool operator==(const T& left, const SnugInt<T>& right);
-    template<class T> friend bool operator!=(const T& left, const SnugInt<T>& right);
-    template<class T> friend bool operator>=(const T& left, const SnugInt<T>& right);
-    template<class T> friend bool operator<=(const T& left, const SnugInt<T>& right);
+    template<class T, class P> friend constexpr bool operator< (const T& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator> (const T& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator==(const T& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator!=(const T& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator>=(const T& left, const SnugInt<T, P>& right) noexcept;
+    template<class T, class P> friend constexpr bool operator<=(const T& left, const SnugInt<T, P>& right) noexcept;
 
     // Stream Operators
-    template <class T> friend std::ostream& operator<<(std::ostream &os, const SnugInt<T>& data);
-    template <class T> friend std::istream& operator>>(std::istream &is, const SnugInt<T>& data);
+    template <class T, class P> friend std::ostream& operator<<(std::ostream &os, const SnugInt<T, P>& data);
+    template <class T, class P> friend std::istream& operator>>(std::istream &is, SnugInt<T, P>& data);
 private:
     Type value; /**< stored value for Type */
-    Type max;   /**< max possible size for Type */
-    Type min;   /**< min possible size for Type */
+
+    static constexpr Type max = std::numeric_limits<Type>::max(); /**< max possible size for Type */
+    static constexpr Type min = std::numeric_limits<Type>::min(); /**< min possible size for Type */
+
+    // Wraps an already checked value without the checks of the converting constructor
+    struct RawTag {};
+    constexpr SnugInt(RawTag, Type item) noexcept : value(item) {};
 
     // Static Precondition Safe Methods
-    static SnugInt SafeAdd(const SnugInt& left, const SnugInt& right);
-    static SnugInt SafeSub(const SnugInt& left, const SnugInt& right);
-    static SnugInt SafeMult(const SnugInt& left, const SnugInt& right);
-    static SnugInt SafeDiv(const SnugInt& left, const SnugInt& right);
+    static constexpr SnugInt SafeAdd(Type left, Type right) noexcept(Policy::nothrow);
+    static constexpr SnugInt SafeSub(Type left, Type right) noexcept(Policy::nothrow);
+    static constexpr SnugInt SafeMult(Type left, Type right) noexcept(Policy::nothrow);
+    static constexpr SnugInt SafeDiv(Type left, Type right) noexcept(Policy::nothrow);
+    static constexpr SnugInt SafeMod(Type left, Type right) noexcept(Policy::nothrow);
 };
 
+// Absolute value, fails for the min of a signed Type
+template<class T, class P> constexpr SnugInt<T, P> abs(const SnugInt<T, P>& item) noexcept(P::nothrow);
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief Integral and Policy of a snug_cast target, a raw integral throws like SnugInt<To>
+     */
+    template<class To>
+    struct CastTarget
+    {
+        typedef To Type;
+        typedef SnugIntThrowPolicy Policy;
+        static constexpr To Make(Type item) noexcept { return item; };
+    };
+
+    template<class T, class P>
+    struct CastTarget<SnugInt<T, P>>
+    {
+        typedef T Type;
+        typedef P Policy;
+        static constexpr SnugInt<T, P> Make(Type item) noexcept { return SnugInt<T, P>(item); };
+    };
+
+    template<class T> constexpr T CastSource(T item) noexcept { return item; };
+    template<class T, class P> constexpr T CastSource(const SnugInt<T, P>& item) noexcept { return item.getValue(); };
+}
+}
+
+// Checked conversions between integrals and SnugInts of any types, see snug::detail::CastCheck
+template<class To, class From> constexpr SnugIntResult<typename snug::detail::CastTarget<To>::Type> snug_try_cast(const From& item) noexcept;
+template<class To, class From> constexpr To snug_cast(const From& item) noexcept(snug::detail::CastTarget<To>::Policy::nothrow);
+
+// Mathematical Operators of mixed width or signedness (SnugInt<T>, U), (U, SnugInt<T>) and (SnugInt<T>, SnugInt<U>)
+// the result has the type and Policy of the SnugInt operand, of the left one for two SnugInts
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator+(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator-(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator*(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator/(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator%(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator+(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator-(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator*(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator/(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator%(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator+(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator-(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator*(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator/(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator%(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+
+// Bitwise Operators of mixed types, the other operand must fit in T (SizeMismatch otherwise)
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator&(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator|(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator^(const SnugInt<T, P>& left, const U& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator&(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator|(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator^(const U& left, const SnugInt<T, P>& right) noexcept(P::nothrow);
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator&(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator|(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+template<class T, class P, class U, class Q> constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator^(const SnugInt<T, P>& left, const SnugInt<U, Q>& right) noexcept(P::nothrow);
+
+// Shift Operators, checked like <<= and >>=
+template<class T, class P, class U> constexpr typename std::enable_if<snug::detail::IsInteger<U>::value, SnugInt<T, P>>::type operator<<(const SnugInt<T, P>& left, const U& shift) noexcept(P::nothrow);
+template<class T, class P, class U> constexpr typename std::enable_if<snug::detail::IsInteger<U>::value, SnugInt<T, P>>::type operator>>(const SnugInt<T, P>& left, const U& shift) noexcept(P::nothrow);
+
 /**
  * \brief SnugInt Exception Addition Overflow
  *
@@ -180,7 +435,7 @@ class SnugInt_Addition_Overflow_Exception: public std::exception
     {
         return "SnugInt addition operation prevented, OVERFLOW would have occurred";
     }
-} snugint_add_overflow;
+};
 
 /**
  * \brief SnugInt Exception Addition Underflow
@@ -199,7 +454,7 @@ class SnugInt_Addition_Underflow_Exception: public std::exception
     {
         return "SnugInt addition operation prevented, UNDERFLOW would have occurred";
     }
-} snugint_add_underflow;
+};
 
 /**
  * \brief SnugInt Exception Subtraction Overflow
@@ -218,7 +473,7 @@ class SnugInt_Subtraction_Overflow_Exception: public std::exception
     {
         return "SnugInt subtraction operation prevented, OVERFLOW would have occurred";
     }
-} snugint_sub_overflow;
+};
 
 /**
  * \brief SnugInt Exception Subtraction Underflow
@@ -237,7 +492,7 @@ class SnugInt_Subtraction_Underflow_Exception: public std::exception
     {
         return "SnugInt subtraction operation prevented, UNDERFLOW would have occurred";
     }
-} snugint_sub_underflow;
+};
 
 /**
  * \brief SnugInt Exception Multiplication Overflow
@@ -256,7 +511,7 @@ class SnugInt_Multiplication_Overflow_Exception: public std::exception
     {
         return "SnugInt multiplication operation prevented, OVERFLOW would have occurred";
     }
-} snugint_mult_overflow;
+};
 
 /**
  * \brief SnugInt Exception Multiplication Underflow
@@ -275,7 +530,7 @@ class SnugInt_Multiplication_Underflow_Exception: public std::exception
     {
         return "SnugInt multiplication operation prevented, UNDERFLOW would have occurred";
     }
-} snugint_mult_underflow;
+};
 
 /**
  * \brief SnugInt Exception Type Size Mismatch
@@ -294,7 +549,7 @@ class SnugInt_Size_Mismatch_Exception: public std::exception
     {
         return "SnugInt Size Mismatch, Operation Failure";
     }
-} snugint_size_mismatch;
+};
 
 /**
  * \brief SnugInt Exception Type Mismatch
@@ -313,8 +568,220 @@ class SnugInt_Type_Mismatch_Exception: public std::exception
     {
         return "SnugInt Type Mismatch, Operation Failure";
     }
-} snugint_type_mismatch;
+};
+
+/**
+ * \brief SnugInt Exception Division By Zero
+ *
+ * \details
+ * This exception is thrown when a SnugInt operation detects a division or remainder by zero
+ * \details
+ * Throws this error to prevent undefined behavior
+ */
+class SnugInt_Division_By_Zero_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt division operation prevented, DIVISION BY ZERO would have occurred";
+    }
+};
+
+/**
+ * \brief SnugInt Exception Division Overflow
+ *
+ * \details
+ * This exception is thrown when a SnugInt operation detects there will be overflow from division,
+ * the only such case is the min of a signed Type divided by -1
+ * \details
+ * Throws this error to prevent overflow
+ */
+class SnugInt_Division_Overflow_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt division operation prevented, OVERFLOW would have occurred";
+    }
+};
+
+/**
+ * \brief SnugInt Exception Division Underflow
+ *
+ * \details
+ * This exception is thrown when a mixed type SnugInt division detects a quotient below the min of Type
+ * \details
+ * Throws this error to prevent underflow
+ */
+class SnugInt_Division_Underflow_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt division operation prevented, UNDERFLOW would have occurred";
+    }
+};
+
+/**
+ * \brief SnugInt Exception Shift Range
+ *
+ * \details
+ * This exception is thrown when a SnugInt shift count is negative or not less than the width of Type
+ * \details
+ * Throws this error to prevent undefined behavior
+ */
+class SnugInt_Shift_Range_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt shift operation prevented, shift count OUT OF RANGE";
+    }
+};
 
+/**
+ * \brief SnugInt Exception Shift Overflow
+ *
+ * \details
+ * This exception is thrown when a SnugInt left shift would push set bits out of a positive value
+ * \details
+ * Throws this error to prevent overflow
+ */
+class SnugInt_Shift_Overflow_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt shift operation prevented, OVERFLOW would have occurred";
+    }
+};
+
+/**
+ * \brief SnugInt Exception Shift Underflow
+ *
+ * \details
+ * This exception is thrown when a SnugInt left shift would push bits out of a negative value
+ * \details
+ * Throws this error to prevent underflow
+ */
+class SnugInt_Shift_Underflow_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt shift operation prevented, UNDERFLOW would have occurred";
+    }
+};
+
+/**
+ * \brief SnugInt Exception Negation Overflow
+ *
+ * \details
+ * This exception is thrown when a SnugInt negation or abs is applied to the min of a signed Type
+ * \details
+ * Throws this error to prevent overflow
+ */
+class SnugInt_Negation_Overflow_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt negation operation prevented, OVERFLOW would have occurred";
+    }
+};
+
+/**
+ * \brief SnugInt Exception Negation Underflow
+ *
+ * \details
+ * This exception is thrown when a SnugInt negation is applied to a non zero unsigned value
+ * \details
+ * Throws this error to prevent underflow
+ */
+class SnugInt_Negation_Underflow_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt negation operation prevented, UNDERFLOW would have occurred";
+    }
+};
+
+/**
+ * \brief SnugInt Exception Invalid Format
+ *
+ * \details
+ * This exception is thrown when text handed to snug::from_chars holds no decimal number
+ * \details
+ * Throws this error to prevent reading a value that was never written
+ */
+class SnugInt_Invalid_Format_Exception: public std::exception
+{
+    const char* what() const noexcept override
+    {
+        return "SnugInt parse operation prevented, INVALID FORMAT of the number";
+    }
+};
+
+/**
+ * \brief One instance of a SnugInt exception for the whole program
+ *
+ * \details
+ * SnugInt throws temporaries, so by default there are no exception objects at namespace scope and nothing
+ * to initialize per translation unit. Defining SNUGINT_EXCEPTION_OBJECTS=1 brings back the named objects
+ * (snugint_add_overflow and the rest) for code that throws them directly. They are static members of a
+ * class template, which the linker merges like inline variables, so there are no duplicate symbols
+ */
+template<class Exception>
+struct SnugIntExceptionObject
+{
+    static const Exception instance;
+};
+
+template<class Exception> const Exception SnugIntExceptionObject<Exception>::instance{};
+
+#ifndef SNUGINT_EXCEPTION_OBJECTS
+#define SNUGINT_EXCEPTION_OBJECTS 0
+#endif
+
+#if SNUGINT_EXCEPTION_OBJECTS
+static const SnugInt_Addition_Overflow_Exception& snugint_add_overflow = SnugIntExceptionObject<SnugInt_Addition_Overflow_Exception>::instance;
+static const SnugInt_Addition_Underflow_Exception& snugint_add_underflow = SnugIntExceptionObject<SnugInt_Addition_Underflow_Exception>::instance;
+static const SnugInt_Subtraction_Overflow_Exception& snugint_sub_overflow = SnugIntExceptionObject<SnugInt_Subtraction_Overflow_Exception>::instance;
+static const SnugInt_Subtraction_Underflow_Exception& snugint_sub_underflow = SnugIntExceptionObject<SnugInt_Subtraction_Underflow_Exception>::instance;
+static const SnugInt_Multiplication_Overflow_Exception& snugint_mult_overflow = SnugIntExceptionObject<SnugInt_Multiplication_Overflow_Exception>::instance;
+static const SnugInt_Multiplication_Underflow_Exception& snugint_mult_underflow = SnugIntExceptionObject<SnugInt_Multiplication_Underflow_Exception>::instance;
+static const SnugInt_Size_Mismatch_Exception& snugint_size_mismatch = SnugIntExceptionObject<SnugInt_Size_Mismatch_Exception>::instance;
+static const SnugInt_Type_Mismatch_Exception& snugint_type_mismatch = SnugIntExceptionObject<SnugInt_Type_Mismatch_Exception>::instance;
+static const SnugInt_Division_By_Zero_Exception& snugint_div_by_zero = SnugIntExceptionObject<SnugInt_Division_By_Zero_Exception>::instance;
+static const SnugInt_Division_Overflow_Exception& snugint_div_overflow = SnugIntExceptionObject<SnugInt_Division_Overflow_Exception>::instance;
+static const SnugInt_Division_Underflow_Exception& snugint_div_underflow = SnugIntExceptionObject<SnugInt_Division_Underflow_Exception>::instance;
+static const SnugInt_Shift_Range_Exception& snugint_shift_range = SnugIntExceptionObject<SnugInt_Shift_Range_Exception>::instance;
+static const SnugInt_Shift_Overflow_Exception& snugint_shift_overflow = SnugIntExceptionObject<SnugInt_Shift_Overflow_Exception>::instance;
+static const SnugInt_Shift_Underflow_Exception& snugint_shift_underflow = SnugIntExceptionObject<SnugInt_Shift_Underflow_Exception>::instance;
+static const SnugInt_Negation_Overflow_Exception& snugint_neg_overflow = SnugIntExceptionObject<SnugInt_Negation_Overflow_Exception>::instance;
+static const SnugInt_Negation_Underflow_Exception& snugint_neg_underflow = SnugIntExceptionObject<SnugInt_Negation_Underflow_Exception>::instance;
+static const SnugInt_Invalid_Format_Exception& snugint_invalid_format = SnugIntExceptionObject<SnugInt_Invalid_Format_Exception>::instance;
+#endif
+
+inline void SnugIntThrow(SnugIntError error);
+[[noreturn]] void SnugIntRaise(SnugIntError error);
+
+#include "SnugIntPolicy.h"
+#include "SnugIntTelemetry.h"
+#include "SnugIntProfile.h"
+#include "SnugIntChars.h"
 #include "SnugInt.tpp"
 
+// Explicit instantiations of the common widths, compiled once into SnugIntInstances (SnugInt.cpp)
+#ifndef SNUGINT_EXTERN_TEMPLATES
+#define SNUGINT_EXTERN_TEMPLATES 0
+#endif
+
+#if SNUGINT_EXTERN_TEMPLATES
+extern template class SnugInt<char>;
+extern template class SnugInt<signed char>;
+extern template class SnugInt<unsigned char>;
+extern template class SnugInt<short>;
+extern template class SnugInt<unsigned short>;
+extern template class SnugInt<int>;
+extern template class SnugInt<unsigned int>;
+extern template class SnugInt<long>;
+extern template class SnugInt<unsigned long>;
+extern template class SnugInt<long long>;
+extern template class SnugInt<unsigned long long>;
+#endif
+
 #endif //PROJECT_SNUGINT_H
@@ -16,55 +16,23 @@ See the License for the specific language governing permissions and
 
 #include "SnugInt.h"
 
+template<class Type, class Policy> constexpr Type SnugInt<Type, Policy>::max;
+template<class Type, class Policy> constexpr Type SnugInt<Type, Policy>::min;
 /**
  * \brief SnugInt default constructor
  *
  * \details
- * Sets only default values for private members
- * This requires there be a proper Type
+ * Sets value to 0, the bounds are compile time constants of Type
+ * so there is nothing else to set up
  *
  * @tparam Type SnugInt integer type
  *
  * \author Stephen Tafoya
  * \Date 3/5/2019
  */
-template<class Type>
-SnugInt<Type>::SnugInt()
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>::SnugInt() noexcept : value(0)
 {
-    min = std::numeric_limits<Type>::min();
-    max = std::numeric_limits<Type>::max();
-
-    // Determines that our value is supported.
-    if (min == max)
-        throw snugint_type_mismatch;
-
-    value = 0;
-}
-
-/**
- * \brief SnugInt copy constructor (SnugInt)
- *
- * \details
- * Takes a SnugInt other and copies value, min and max.
- * This requires the SnugInt's to be the same type.
- *
- * @tparam Type SnugInt integer type
- * @param other SnugInt to be copied
- *
- * \author Stephen Tafoya
- * \date 3/5/2019
- */
-template<class Type>
-SnugInt<Type>::SnugInt(const SnugInt<Type> &other)
-{
-    max = other.max;
-    min = other.min;
-
-    // Determines that our value is supported.
-    if (min == max)
-        throw snugint_type_mismatch;
-
-    value = other.value;
 }
 
 /**
@@ -72,7 +40,7 @@ SnugInt<Type>::SnugInt(const SnugInt<Type> &other)
  *
  * \details
  * Takes an unknown item T and attempts to assign it to value
- * Requires that T is a numerical value and that it fits into Type
+ * Requires that T is an integral (other types do not take part in overload resolution) and that it fits into Type
  *
  * @tparam Type SnugInt integer type
  * @tparam T unknown item type
@@ -81,55 +49,18 @@ SnugInt<Type>::SnugInt(const SnugInt<Type> &other)
  * \author Stephen Tafoya
  * \date 3/10/2019
  */
-template<class Type>
-template<class T>
-SnugInt<Type>::SnugInt(const T &item)
-{
-    static_assert(std::is_integral<T>::value, "Cannot assign SnugInt to a non integral type.");
-
-    min = std::numeric_limits<Type>::min();
-    max = std::numeric_limits<Type>::max();
-
-    // Determines that our value is supported.
-    if (min == max)
-        throw snugint_type_mismatch;
-
-    // Throw an error if the item will not fit in our Type
-    if (item > max || item < min)
-        throw snugint_size_mismatch;
-
-    value = item;
-}
-
-/**
- * \brief SnugInt assignment operator <SnugInt>
- *
- * \details
- * Takes a SnugInt and assigns its values to value, max, min.
- * Requires the SnugInt's type to be the same
- *
- * @tparam Type SnugInt integer type
- * @param other SnugInt to be assigned from
- * @return resulting SnugInt object
- *
- * \author Stephen Tafoya
- * \date 3/5/2019
- */
-template<class Type>
-SnugInt<Type>& SnugInt<Type>::operator=(const SnugInt<Type> &other)
+template<class Type, class Policy>
+template<class T, class>
+constexpr SnugInt<Type, Policy>::SnugInt(const T &item) noexcept(Policy::nothrow)
+    : value(Resolve(TryFrom(item), snug::detail::IsNegative(item) ? min : max))
 {
-    value = other.value;
-    max = other.max;
-    min = other.min;
-
-    return *this;
 }
 
 /**
  * \brief SnugInt assignment operator <Type>
  *
  * \details
- * Takes a Type variable and assigns its value to value and finds the max and min.
+ * Takes a Type variable and assigns its value to value.
  * Requires that other be of type Type
  *
  * @tparam Type SnugInt integer type
@@ -139,8 +70,8 @@ SnugInt<Type>& SnugInt<Type>::operator=(const SnugInt<Type> &other)
  * \author Stephen Tafoya
  * \date 3/5/2019
  */
-template<class Type>
-SnugInt<Type> &SnugInt<Type>::operator=(const Type &other) {
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy> &SnugInt<Type, Policy>::operator=(const Type &other) noexcept {
     value = other;
     return *this;
 }
@@ -149,16 +80,16 @@ SnugInt<Type> &SnugInt<Type>::operator=(const Type &other) {
  * \brief SnugInt addition assignment operator (SnugInt, SnugInt)
  *
  * \details
- * Calls SafeAdd to perform precondition checks and addition
+ * Adds the raw values in place, no temporary SnugInt is created
  *
  * @tparam Type SnugInt integer type
  * @param other the other SnugInt being add/assigned
  * @return new reference value of this + other
  */
-template<class Type>
-SnugInt<Type>& SnugInt<Type>::operator+=(const SnugInt<Type>& other)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator+=(const SnugInt<Type, Policy>& other) noexcept(Policy::nothrow)
 {
-    value = this->SafeAdd(value, other).getValue();
+    value = Resolve(TryAdd(value, other.value));
     return *this;
 }
 
@@ -166,714 +97,2494 @@ SnugInt<Type>& SnugInt<Type>::operator+=(const SnugInt<Type>& other)
  * \brief SnugInt addition assignment operator (SnugInt, Type)
  *
  * \details
- * Calls SafeAdd to perform precondition checks and addition
+ * Adds the raw values in place, no temporary SnugInt is created
  *
  * @tparam Type SnugInt integer type
  * @param other the other Type being add/assigned
  * @return new reference value of this + other
  */
-template<class Type>
-SnugInt<Type>& SnugInt<Type>::operator+=(const Type& other)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator+=(const Type& other) noexcept(Policy::nothrow)
 {
-    SnugInt<Type> temp = other;
-    value = this->SafeAdd(value, temp).getValue();
+    value = Resolve(TryAdd(value, other));
     return *this;
 }
+
 /**
- * \brief SnugInt addition operator overload (SnugInt, SnugInt)
+ * \brief SnugInt subtraction assignment operator (SnugInt, SnugInt)
  *
  * \details
- * Calls SafeAdd to perform precondition checks and addition
- *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be added
- * @param right SnugInt to be added
- * @return sum of left and right
+ * Checks TrySub against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other SnugInt value is subtracted by
+ * @return new reference value of this - other
  */
-template<class T>
-SnugInt<T> operator+(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator-=(const SnugInt<Type, Policy>& other) noexcept(Policy::nothrow)
 {
-    return left.SafeAdd(left, right);
+    value = Resolve(TrySub(value, other.value));
+    return *this;
 }
 
 /**
- * \brief SnugInt subtraction operator overload (SnugInt, SnugInt)
+ * \brief SnugInt subtraction assignment operator (SnugInt, Type)
  *
  * \details
- * Calls SafeSub to perform precondition checks and subtraction
- * @tparam T SnugInt integer type
- * @param left SnugInt to be subtracted from
- * @param right SnugInt to be subtracted
- * @return difference of left and right
+ * Checks TrySub against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other Type value is subtracted by
+ * @return new reference value of this - other
  */
-template<class T>
-SnugInt<T> operator-(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator-=(const Type& other) noexcept(Policy::nothrow)
 {
-    return left.SafeSub(left, right);
+    value = Resolve(TrySub(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt multiplication operator overload (SnugInt, SnugInt)
+ * \brief SnugInt multiplication assignment operator (SnugInt, SnugInt)
  *
  * \details
- * Calls SafeMult to perform precondition checks and multiplication
- * @tparam T SnugInt integer type
- * @param left SnugInt to be multiplied
- * @param right SnugInt to be multiplied
- * @return product of left and right
+ * Checks TryMult against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other SnugInt value is multiplied by
+ * @return new reference value of this * other
  */
-template<class T>
-SnugInt<T> operator*(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator*=(const SnugInt<Type, Policy>& other) noexcept(Policy::nothrow)
 {
-    return left.SafeMult(left, right);
+    value = Resolve(TryMult(value, other.value));
+    return *this;
 }
 
 /**
- * \brief SnugInt division operator overload (SnugInt, SnugInt)
+ * \brief SnugInt multiplication assignment operator (SnugInt, Type)
  *
  * \details
- * Calls SafeDiv to perform precondition checks and division
- * @tparam T SnugInt integer type
- * @param left SnugInt to be divided
- * @param right SnugInt to divide by
- * @return division of left / right
+ * Checks TryMult against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other Type value is multiplied by
+ * @return new reference value of this * other
  */
-template<class T>
-SnugInt<T> operator/(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator*=(const Type& other) noexcept(Policy::nothrow)
 {
-    return left.SafeDiv(left, right);
+    value = Resolve(TryMult(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt addition operator overload (SnugInt, T)
+ * \brief SnugInt division assignment operator (SnugInt, SnugInt)
  *
  * \details
- * Calls SafeAdd to perform precondition checks and addition
- *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be added
- * @param right T to be added
- * @return sum of left and right
+ * Checks TryDiv against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other SnugInt value is divided by
+ * @return new reference value of this / other
  */
-template<class T>
-SnugInt<T> operator+(const SnugInt<T> &left, const T &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator/=(const SnugInt<Type, Policy>& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(right);
-    return left.SafeAdd(left, temp);
+    value = Resolve(TryDiv(value, other.value));
+    return *this;
 }
 
 /**
- * \brief SnugInt subtraction operator overload (SnugInt, T)
+ * \brief SnugInt division assignment operator (SnugInt, Type)
  *
  * \details
- * Calls SafeSub to perform precondition checks and subtraction
- *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be subtracted from
- * @param right T to be subtracted
- * @return difference of left and right
+ * Checks TryDiv against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other Type value is divided by
+ * @return new reference value of this / other
  */
-template<class T>
-SnugInt<T> operator-(const SnugInt<T> &left, const T &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator/=(const Type& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(right);
-    return left.SafeSub(left, temp);
+    value = Resolve(TryDiv(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt multiplication operator overload (SnugInt, T)
+ * \brief SnugInt remainder assignment operator (SnugInt, SnugInt)
  *
  * \details
- * Calls SafeMult to perform precondition checks and multiplication
- *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be multiplied
- * @param right T to be multiplied
- * @return product of left and right
+ * Checks TryMod against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other SnugInt value is divided by
+ * @return new reference value of this % other
  */
-template<class T>
-SnugInt<T> operator*(const SnugInt<T> &left, const T &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator%=(const SnugInt<Type, Policy>& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(right);
-    return left.SafeMult(left, temp);
+    value = Resolve(TryMod(value, other.value));
+    return *this;
 }
 
 /**
- * \brief SnugInt division operator overload (SnugInt, T)
+ * \brief SnugInt remainder assignment operator (SnugInt, Type)
  *
  * \details
- * Calls SafeDiv to perform precondition checks and division
- *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be divided
- * @param right T to divide by
- * @return product of left and right
+ * Checks TryMod against value in place, no temporary SnugInt is created
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @param other the other Type value is divided by
+ * @return new reference value of this % other
  */
-template<class T>
-SnugInt<T> operator/(const SnugInt<T> &left, const T &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator%=(const Type& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(right);
-    return left.SafeDiv(left, temp);
+    value = Resolve(TryMod(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt addition operator overload (T, SnugInt)
+ * \brief SnugInt addition assignment operator (SnugInt, U)
  *
  * \details
- * Calls SafeAdd to perform precondition checks and addition
- *
- * @tparam T SnugInt integer type
- * @param left T to be added
- * @param right SnugInt to be added
- * @return addition of left and right
+ * Checks the exact result of value + other against Type in place, other may be any integral type
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @tparam U integral type of other
+ * @param other the other value
+ * @return new reference value of this + other
  */
-template<class T>
-SnugInt<T> operator+(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator+=(const U& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(left);
-    return right.SafeAdd(temp, right);
+    value = Resolve(TryAdd(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt subtraction operator overload (T, SnugInt)
+ * \brief SnugInt subtraction assignment operator (SnugInt, U)
  *
  * \details
- * Calls SafeSub to perform precondition checks and subtraction
- *
- * @tparam T SnugInt integer type
- * @param left T to be subtracted from
- * @param right SnugInt to be subtracted
- * @return difference of left and right
+ * Checks the exact result of value - other against Type in place, other may be any integral type
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @tparam U integral type of other
+ * @param other the other value
+ * @return new reference value of this - other
  */
-template<class T>
-SnugInt<T> operator-(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator-=(const U& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(left);
-    return right.SafeSub(temp, right);
+    value = Resolve(TrySub(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt multiplication operator overload (T, SnugInt)
+ * \brief SnugInt multiplication assignment operator (SnugInt, U)
  *
  * \details
- * Calls SafeMult to perform precondition checks and multiplication
- *
- * @tparam T SnugInt integer type
- * @param left T to be multiplied
- * @param right SnugInt to be multiplied
- * @return product of left and right
+ * Checks the exact result of value * other against Type in place, other may be any integral type
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @tparam U integral type of other
+ * @param other the other value
+ * @return new reference value of this * other
  */
-template<class T>
-SnugInt<T> operator*(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator*=(const U& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(left);
-    return right.SafeMult(temp, right);
+    value = Resolve(TryMult(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt division operator overload (T, SnugInt)
+ * \brief SnugInt division assignment operator (SnugInt, U)
  *
  * \details
- * Calls SafeDiv to perform precondition checks and division
- *
- * @tparam T SnugInt integer type
- * @param left T to be divided
- * @param right SnugInt to divide by
- * @return product of left and right
+ * Checks the exact result of value / other against Type in place, other may be any integral type
  *
- * \author Stephen Tafoya
- * \date 3/9/2019
+ * @tparam Type SnugInt integer type
+ * @tparam U integral type of other
+ * @param other the other value
+ * @return new reference value of this / other
  */
-template<class T>
-SnugInt<T> operator/(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator/=(const U& other) noexcept(Policy::nothrow)
 {
-    SnugInt<T> temp(left);
-    return right.SafeDiv(temp, right);
+    value = Resolve(TryDiv(value, other));
+    return *this;
 }
 
 /**
- * \brief SnugInt increment operator
+ * \brief SnugInt modulo assignment operator (SnugInt, U)
  *
  * \details
- * Performs a simple precondition check and then increments value by 1
+ * Takes the exact remainder of value / other in place, other may be any integral type and is never narrowed
  *
  * @tparam Type SnugInt integer type
- * @return resulting SnugInt object
- *
- * \author Stephen Tafoya
- * \date 3/5/2019
+ * @tparam U integral type of other
+ * @param other the other value
+ * @return new reference value of this % other
  */
-template<class Type>
-SnugInt<Type>& SnugInt<Type>::operator++()
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator%=(const U& other) noexcept(Policy::nothrow)
 {
-    if (value == max)
-        throw snugint_add_overflow;
-
-    value++;
-
+    value = Resolve(TryMod(value, other));
     return *this;
 }
 
 /**
- * \brief SnugInt increment operator (int)
+ * \brief SnugInt left shift assignment operator
  *
  * \details
- * Performs a simple precondition check and then increments value by 1
+ * Checks TryShiftLeft against value in place, an out of range shift saturates
+ * like the overflow it stands for (0 stays 0)
  *
  * @tparam Type SnugInt integer type
- * @return resulting SnugInt object
- *
- * \author Stephen Tafoya
- * \date 3/5/2019
+ * @tparam T integral type of the shift count
+ * @param shift number of bits to shift by
+ * @return new reference value of this << shift
  */
-template<class Type>
-const SnugInt<Type> SnugInt<Type>::operator++(int)
+template<class Type, class Policy>
+template<class T>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator<<=(const T& shift) noexcept(Policy::nothrow)
 {
-    if (value == max)
-        throw snugint_add_overflow;
-
-    SnugInt<Type> temp = *this;
-    ++*this;
-
-    return temp;
+    value = Resolve(TryShiftLeft(value, shift), value == 0 ? 0 : (value < 0 ? min : max));
+    return *this;
 }
 
 /**
- * \brief SnugInt decrement operator
+ * \brief SnugInt right shift assignment operator
  *
  * \details
- * Performs a simple precondition check and then decrements value by 1
+ * Checks TryShiftRight against value in place, an out of range shift saturates to
+ * the value every bit shifted out would give (0 or -1)
  *
  * @tparam Type SnugInt integer type
- * @return resulting SnugInt object
- *
- * \author Stephen Tafoya
- * \date 3/5/2019
+ * @tparam T integral type of the shift count
+ * @param shift number of bits to shift by
+ * @return new reference value of this >> shift
  */
-template<class Type>
-SnugInt<Type>& SnugInt<Type>::operator--()
+template<class Type, class Policy>
+template<class T>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator>>=(const T& shift) noexcept(Policy::nothrow)
 {
-    // precondition check
-    if (value == min)
-        throw snugint_sub_underflow;
-
-    value--;
-
+    value = Resolve(TryShiftRight(value, shift), static_cast<Type>(value < 0 ? -1 : 0));
     return *this;
 }
 
 /**
- * \brief SnugInt decrement operator (int)
+ * \brief SnugInt bitwise and assignment operator
  *
  * \details
- * Performs a simple precondition check and then decrements value by 1
+ * Bitwise operations can not fail, no check is done
  *
  * @tparam Type SnugInt integer type
- * @return resulting SnugInt object
- *
- * \author Stephen Tafoya
- * \date 3/5/2019
+ * @param other SnugInt to and with
+ * @return new reference value of this & other
  */
-template<class Type>
-const SnugInt<Type> SnugInt<Type>::operator--(int)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator&=(const SnugInt<Type, Policy>& other) noexcept
 {
-    // precondition check
-    if (value == min)
-        throw snugint_sub_underflow;
-
-    SnugInt<Type> temp = *this;
-    --*this;
-
-    return temp;
+    value = static_cast<Type>(value & other.value);
+    return *this;
 }
 
 /**
- * \brief SnugInt LT comparison operator overload (SnugInt, SnugInt)
- *
- * \details
- * Returns the less than comparison of left.value and right.value
+ * \brief SnugInt bitwise and assignment operator (Type)
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @tparam Type SnugInt integer type
+ * @param other Type to and with
+ * @return new reference value of this & other
  */
-template<class T>
-bool operator<(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator&=(const Type& other) noexcept
 {
-    return left.value < right.value;
+    value = static_cast<Type>(value & other);
+    return *this;
 }
 
 /**
- * \brief SnugInt GT comparison operator overload (SnugInt, SnugInt)
+ * \brief SnugInt bitwise and assignment operator of mixed types
  *
  * \details
- * Returns the greater than comparison of left.value and right.value
+ * other must fit in Type, a value that does not is a SizeMismatch handed to the Policy
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @tparam Type SnugInt integer type
+ * @tparam U integral type of other
+ * @param other U to and with
+ * @return new reference value of this & other
  */
-template<class T>
-bool operator>(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator&=(const U& other) noexcept(Policy::nothrow)
 {
-    return left.value > right.value;
+    value = static_cast<Type>(value & SnugInt(other).value);
+    return *this;
 }
 
 /**
- * \brief SnugInt EQ comparison operator overload (SnugInt, SnugInt)
+ * \brief SnugInt bitwise or assignment operator
  *
  * \details
- * Returns the equality comparison of left.value and right.value
+ * Bitwise operations can not fail, no check is done
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @tparam Type SnugInt integer type
+ * @param other SnugInt to or with
+ * @return new reference value of this | other
  */
-template<class T>
-bool operator==(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator|=(const SnugInt<Type, Policy>& other) noexcept
 {
-    return left.value == right.value;
+    value = static_cast<Type>(value | other.value);
+    return *this;
 }
 
 /**
- * \brief SnugInt NEQ comparison operator overload (SnugInt, SnugInt)
+ * \brief SnugInt bitwise or assignment operator (Type)
  *
- * \details
- * Returns the non-equality comparison of left.value and right.value
+ * @tparam Type SnugInt integer type
+ * @param other Type to or with
+ * @return new reference value of this | other
+ */
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator|=(const Type& other) noexcept
+{
+    value = static_cast<Type>(value | other);
+    return *this;
+}
+
+/**
+ * \brief SnugInt bitwise or assignment operator of mixed types
+ *
+ * \details
+ * other must fit in Type, a value that does not is a SizeMismatch handed to the Policy
+ *
+ * @tparam Type SnugInt integer type
+ * @tparam U integral type of other
+ * @param other U to or with
+ * @return new reference value of this | other
+ */
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator|=(const U& other) noexcept(Policy::nothrow)
+{
+    value = static_cast<Type>(value | SnugInt(other).value);
+    return *this;
+}
+
+/**
+ * \brief SnugInt bitwise xor assignment operator
+ *
+ * \details
+ * Bitwise operations can not fail, no check is done
+ *
+ * @tparam Type SnugInt integer type
+ * @param other SnugInt to xor with
+ * @return new reference value of this ^ other
+ */
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator^=(const SnugInt<Type, Policy>& other) noexcept
+{
+    value = static_cast<Type>(value ^ other.value);
+    return *this;
+}
+
+/**
+ * \brief SnugInt bitwise xor assignment operator (Type)
+ *
+ * @tparam Type SnugInt integer type
+ * @param other Type to xor with
+ * @return new reference value of this ^ other
+ */
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator^=(const Type& other) noexcept
+{
+    value = static_cast<Type>(value ^ other);
+    return *this;
+}
+
+/**
+ * \brief SnugInt bitwise xor assignment operator of mixed types
+ *
+ * \details
+ * other must fit in Type, a value that does not is a SizeMismatch handed to the Policy
+ *
+ * @tparam Type SnugInt integer type
+ * @tparam U integral type of other
+ * @param other U to xor with
+ * @return new reference value of this ^ other
+ */
+template<class Type, class Policy>
+template<class U>
+constexpr snug::detail::EnableMixed<Type, Type, U, SnugInt<Type, Policy>&> SnugInt<Type, Policy>::operator^=(const U& other) noexcept(Policy::nothrow)
+{
+    value = static_cast<Type>(value ^ SnugInt(other).value);
+    return *this;
+}
+/**
+ * \brief SnugInt addition operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Calls SafeAdd to perform precondition checks and addition
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be added
+ * @param right SnugInt to be added
+ * @return sum of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator+(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return left.SafeAdd(left.value, right.value);
+}
+
+/**
+ * \brief SnugInt subtraction operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Calls SafeSub to perform precondition checks and subtraction
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be subtracted from
+ * @param right SnugInt to be subtracted
+ * @return difference of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator-(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return left.SafeSub(left.value, right.value);
+}
+
+/**
+ * \brief SnugInt multiplication operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Calls SafeMult to perform precondition checks and multiplication
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be multiplied
+ * @param right SnugInt to be multiplied
+ * @return product of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator*(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return left.SafeMult(left.value, right.value);
+}
+
+/**
+ * \brief SnugInt division operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Calls SafeDiv to perform precondition checks and division
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be divided
+ * @param right SnugInt to divide by
+ * @return division of left / right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator/(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return left.SafeDiv(left.value, right.value);
+}
+
+/**
+ * \brief SnugInt remainder operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Calls SafeMod to perform precondition checks and the remainder
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be divided
+ * @param right SnugInt to divide by
+ * @return remainder of left / right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator%(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return left.SafeMod(left.value, right.value);
+}
+
+/**
+ * \brief SnugInt addition operator overload (SnugInt, T)
+ *
+ * \details
+ * Calls SafeAdd to perform precondition checks and addition
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be added
+ * @param right T to be added
+ * @return sum of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator+(const SnugInt<T, P> &left, const T &right) noexcept(P::nothrow)
+{
+    return left.SafeAdd(left.value, right);
+}
+
+/**
+ * \brief SnugInt subtraction operator overload (SnugInt, T)
+ *
+ * \details
+ * Calls SafeSub to perform precondition checks and subtraction
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be subtracted from
+ * @param right T to be subtracted
+ * @return difference of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator-(const SnugInt<T, P> &left, const T &right) noexcept(P::nothrow)
+{
+    return left.SafeSub(left.value, right);
+}
+
+/**
+ * \brief SnugInt multiplication operator overload (SnugInt, T)
+ *
+ * \details
+ * Calls SafeMult to perform precondition checks and multiplication
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be multiplied
+ * @param right T to be multiplied
+ * @return product of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator*(const SnugInt<T, P> &left, const T &right) noexcept(P::nothrow)
+{
+    return left.SafeMult(left.value, right);
+}
+
+/**
+ * \brief SnugInt division operator overload (SnugInt, T)
+ *
+ * \details
+ * Calls SafeDiv to perform precondition checks and division
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be divided
+ * @param right T to divide by
+ * @return product of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator/(const SnugInt<T, P> &left, const T &right) noexcept(P::nothrow)
+{
+    return left.SafeDiv(left.value, right);
+}
+
+/**
+ * \brief SnugInt remainder operator overload (SnugInt, T)
+ *
+ * \details
+ * Calls SafeMod to perform precondition checks and the remainder
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be divided
+ * @param right T to divide by
+ * @return remainder of left / right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator%(const SnugInt<T, P> &left, const T &right) noexcept(P::nothrow)
+{
+    return left.SafeMod(left.value, right);
+}
+
+/**
+ * \brief SnugInt addition operator overload (T, SnugInt)
+ *
+ * \details
+ * Calls SafeAdd to perform precondition checks and addition
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be added
+ * @param right SnugInt to be added
+ * @return addition of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator+(const T &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return right.SafeAdd(left, right.value);
+}
+
+/**
+ * \brief SnugInt subtraction operator overload (T, SnugInt)
+ *
+ * \details
+ * Calls SafeSub to perform precondition checks and subtraction
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be subtracted from
+ * @param right SnugInt to be subtracted
+ * @return difference of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator-(const T &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return right.SafeSub(left, right.value);
+}
+
+/**
+ * \brief SnugInt multiplication operator overload (T, SnugInt)
+ *
+ * \details
+ * Calls SafeMult to perform precondition checks and multiplication
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be multiplied
+ * @param right SnugInt to be multiplied
+ * @return product of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator*(const T &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return right.SafeMult(left, right.value);
+}
+
+/**
+ * \brief SnugInt division operator overload (T, SnugInt)
+ *
+ * \details
+ * Calls SafeDiv to perform precondition checks and division
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be divided
+ * @param right SnugInt to divide by
+ * @return product of left and right
+ *
+ * \author Stephen Tafoya
+ * \date 3/9/2019
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator/(const T &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return right.SafeDiv(left, right.value);
+}
+
+/**
+ * \brief SnugInt remainder operator overload (T, SnugInt)
+ *
+ * \details
+ * Calls SafeMod to perform precondition checks and the remainder
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be divided
+ * @param right SnugInt to divide by
+ * @return remainder of left / right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator%(const T &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return right.SafeMod(left, right.value);
+}
+
+/**
+ * \brief SnugInt addition operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * Checks the exact result against T, right may be any integral type
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left + right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator+(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryAdd(left.getValue(), right)));
+}
+
+/**
+ * \brief SnugInt addition operator overload of mixed types (U, SnugInt<T>)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left + right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator+(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryAdd(left, right.getValue())));
+}
+
+/**
+ * \brief SnugInt addition operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, and of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left + right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator+(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryAdd(left.getValue(), right.getValue())));
+}
+
+/**
+ * \brief SnugInt subtraction operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * Checks the exact result against T, right may be any integral type
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left - right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator-(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TrySub(left.getValue(), right)));
+}
+
+/**
+ * \brief SnugInt subtraction operator overload of mixed types (U, SnugInt<T>)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left - right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator-(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TrySub(left, right.getValue())));
+}
+
+/**
+ * \brief SnugInt subtraction operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, and of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left - right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator-(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TrySub(left.getValue(), right.getValue())));
+}
+
+/**
+ * \brief SnugInt multiplication operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * Checks the exact result against T, right may be any integral type
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left * right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator*(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryMult(left.getValue(), right)));
+}
+
+/**
+ * \brief SnugInt multiplication operator overload of mixed types (U, SnugInt<T>)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left * right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator*(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryMult(left, right.getValue())));
+}
+
+/**
+ * \brief SnugInt multiplication operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, and of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left * right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator*(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryMult(left.getValue(), right.getValue())));
+}
+
+/**
+ * \brief SnugInt division operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * Checks the exact result against T, right may be any integral type
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left / right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator/(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryDiv(left.getValue(), right)));
+}
+
+/**
+ * \brief SnugInt division operator overload of mixed types (U, SnugInt<T>)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left / right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator/(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryDiv(left, right.getValue())));
+}
+
+/**
+ * \brief SnugInt division operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, and of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left / right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator/(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryDiv(left.getValue(), right.getValue())));
+}
+
+/**
+ * \brief SnugInt modulo operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * Takes the exact remainder, right may be any integral type, min % -1 is 0
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left % right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator%(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryMod(left.getValue(), right)));
+}
+
+/**
+ * \brief SnugInt modulo operator overload of mixed types (U, SnugInt<T>)
+ *
+ * \details
+ * The remainder has the sign of left, a negative one does not fit an unsigned T (DivisionUnderflow)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left % right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator%(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryMod(left, right.getValue())));
+}
+
+/**
+ * \brief SnugInt modulo operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, and of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left % right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator%(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryMod(left.getValue(), right.getValue())));
+}
+
+/**
+ * \brief SnugInt bitwise and operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Bitwise operations can not fail, this is the raw operator
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left & right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator&(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left.value & right.value));
+}
+
+/**
+ * \brief SnugInt bitwise and operator overload (SnugInt, T)
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt operand
+ * @param right T operand
+ * @return left & right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator&(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left.value & right));
+}
+
+/**
+ * \brief SnugInt bitwise and operator overload (T, SnugInt)
+ *
+ * @tparam T SnugInt integer type
+ * @param left T operand
+ * @param right SnugInt operand
+ * @return left & right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator&(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left & right.value));
+}
+
+/**
+ * \brief SnugInt bitwise or operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Bitwise operations can not fail, this is the raw operator
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left | right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator|(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left.value | right.value));
+}
+
+/**
+ * \brief SnugInt bitwise or operator overload (SnugInt, T)
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt operand
+ * @param right T operand
+ * @return left | right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator|(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left.value | right));
+}
+
+/**
+ * \brief SnugInt bitwise or operator overload (T, SnugInt)
+ *
+ * @tparam T SnugInt integer type
+ * @param left T operand
+ * @param right SnugInt operand
+ * @return left | right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator|(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left | right.value));
+}
+
+/**
+ * \brief SnugInt bitwise xor operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Bitwise operations can not fail, this is the raw operator
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left ^ right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator^(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left.value ^ right.value));
+}
+
+/**
+ * \brief SnugInt bitwise xor operator overload (SnugInt, T)
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt operand
+ * @param right T operand
+ * @return left ^ right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator^(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left.value ^ right));
+}
+
+/**
+ * \brief SnugInt bitwise xor operator overload (T, SnugInt)
+ *
+ * @tparam T SnugInt integer type
+ * @param left T operand
+ * @param right SnugInt operand
+ * @return left ^ right
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> operator^(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return SnugInt<T, P>(typename SnugInt<T, P>::RawTag(), static_cast<T>(left ^ right.value));
+}
+
+/**
+ * \brief SnugInt bitwise and operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * right must fit in T, a value that does not is a SizeMismatch handed to the Policy.
+ * The check folds away for a constant mask
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left & right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator&(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(static_cast<T>(left.getValue() & SnugInt<T, P>(right).getValue()));
+}
+
+/**
+ * \brief SnugInt bitwise and operator overload of mixed types (U, SnugInt<T>)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left & right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator&(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(static_cast<T>(SnugInt<T, P>(left).getValue() & right.getValue()));
+}
+
+/**
+ * \brief SnugInt bitwise and operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, the type of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left & right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator&(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return left & right.getValue();
+}
+
+/**
+ * \brief SnugInt bitwise or operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * right must fit in T, a value that does not is a SizeMismatch handed to the Policy.
+ * The check folds away for a constant mask
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left | right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator|(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(static_cast<T>(left.getValue() | SnugInt<T, P>(right).getValue()));
+}
+
+/**
+ * \brief SnugInt bitwise or operator overload of mixed types (U, SnugInt<T>)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left | right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator|(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(static_cast<T>(SnugInt<T, P>(left).getValue() | right.getValue()));
+}
+
+/**
+ * \brief SnugInt bitwise or operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, the type of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left | right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator|(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return left | right.getValue();
+}
+
+/**
+ * \brief SnugInt bitwise xor operator overload of mixed types (SnugInt<T>, U)
+ *
+ * \details
+ * right must fit in T, a value that does not is a SizeMismatch handed to the Policy.
+ * The check folds away for a constant mask
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of right
+ * @param left SnugInt operand
+ * @param right U operand
+ * @return left ^ right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator^(const SnugInt<T, P> &left, const U &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(static_cast<T>(left.getValue() ^ SnugInt<T, P>(right).getValue()));
+}
+
+/**
+ * \brief SnugInt bitwise xor operator overload of mixed types (U, SnugInt<T>)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of left
+ * @param left U operand
+ * @param right SnugInt operand
+ * @return left ^ right as SnugInt<T, P>
+ */
+template<class T, class P, class U>
+constexpr snug::detail::EnableMixed<T, U, T, SnugInt<T, P>> operator^(const U &left, const SnugInt<T, P> &right) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(static_cast<T>(SnugInt<T, P>(left).getValue() ^ right.getValue()));
+}
+
+/**
+ * \brief SnugInt bitwise xor operator overload of mixed types (SnugInt<T>, SnugInt<U>)
+ *
+ * @tparam T SnugInt integer type of left, the type of the result
+ * @tparam U SnugInt integer type of right
+ * @param left SnugInt operand
+ * @param right SnugInt operand
+ * @return left ^ right as SnugInt<T, P>
+ */
+template<class T, class P, class U, class Q>
+constexpr snug::detail::EnableMixed<T, T, U, SnugInt<T, P>> operator^(const SnugInt<T, P> &left, const SnugInt<U, Q> &right) noexcept(P::nothrow)
+{
+    return left ^ right.getValue();
+}
+
+/**
+ * \brief SnugInt left shift operator
+ *
+ * \details
+ * Checked like <<=, the count must be in [0, width of T) and no set bit or sign may be lost
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of the shift count
+ * @param left SnugInt to be shifted
+ * @param shift number of bits to shift by
+ * @return left << shift
+ */
+template<class T, class P, class U>
+constexpr typename std::enable_if<snug::detail::IsInteger<U>::value, SnugInt<T, P>>::type operator<<(const SnugInt<T, P> &left, const U &shift) noexcept(P::nothrow)
+{
+    SnugInt<T, P> result = left;
+    result <<= shift;
+    return result;
+}
+
+/**
+ * \brief SnugInt right shift operator
+ *
+ * \details
+ * Checked like >>=, the count must be in [0, width of T)
+ *
+ * @tparam T SnugInt integer type
+ * @tparam U integral type of the shift count
+ * @param left SnugInt to be shifted
+ * @param shift number of bits to shift by
+ * @return left >> shift
+ */
+template<class T, class P, class U>
+constexpr typename std::enable_if<snug::detail::IsInteger<U>::value, SnugInt<T, P>>::type operator>>(const SnugInt<T, P> &left, const U &shift) noexcept(P::nothrow)
+{
+    SnugInt<T, P> result = left;
+    result >>= shift;
+    return result;
+}
+
+/**
+ * \brief SnugInt increment operator
+ *
+ * \details
+ * Checks TryAdd of value and 1 in place, max turns into an AdditionOverflow
+ *
+ * @tparam Type SnugInt integer type
+ * @return resulting SnugInt object
+ *
+ * \author Stephen Tafoya
+ * \date 3/5/2019
+ */
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator++() noexcept(Policy::nothrow)
+{
+    // TryAdd keeps the wrapped value, so without checks this is the plain increment
+    value = Resolve(TryAdd(value, static_cast<Type>(1)));
+
+    return *this;
+}
+
+/**
+ * \brief SnugInt increment operator (int)
+ *
+ * \details
+ * Performs a simple precondition check and then increments value by 1
+ *
+ * @tparam Type SnugInt integer type
+ * @return resulting SnugInt object
+ *
+ * \author Stephen Tafoya
+ * \date 3/5/2019
+ */
+template<class Type, class Policy>
+constexpr const SnugInt<Type, Policy> SnugInt<Type, Policy>::operator++(int) noexcept(Policy::nothrow)
+{
+    SnugInt<Type, Policy> temp = *this;
+    ++*this;
+
+    return temp;
+}
+
+/**
+ * \brief SnugInt decrement operator
+ *
+ * \details
+ * Checks TrySub of value and 1 in place, min turns into a SubtractionUnderflow
+ *
+ * @tparam Type SnugInt integer type
+ * @return resulting SnugInt object
+ *
+ * \author Stephen Tafoya
+ * \date 3/5/2019
+ */
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy>& SnugInt<Type, Policy>::operator--() noexcept(Policy::nothrow)
+{
+    value = Resolve(TrySub(value, static_cast<Type>(1)));
+
+    return *this;
+}
+
+/**
+ * \brief SnugInt decrement operator (int)
+ *
+ * \details
+ * Performs a simple precondition check and then decrements value by 1
+ *
+ * @tparam Type SnugInt integer type
+ * @return resulting SnugInt object
+ *
+ * \author Stephen Tafoya
+ * \date 3/5/2019
+ */
+template<class Type, class Policy>
+constexpr const SnugInt<Type, Policy> SnugInt<Type, Policy>::operator--(int) noexcept(Policy::nothrow)
+{
+    SnugInt<Type, Policy> temp = *this;
+    --*this;
+
+    return temp;
+}
+
+/**
+ * \brief SnugInt negation operator
+ *
+ * \details
+ * Checks TryNegate, the min of a signed Type and any non zero unsigned value can not be negated
+ *
+ * @tparam Type SnugInt integer type
+ * @return -value
+ */
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy> SnugInt<Type, Policy>::operator-() const noexcept(Policy::nothrow)
+{
+    return SnugInt<Type, Policy>(RawTag(), Resolve(TryNegate(value)));
+}
+
+/**
+ * \brief Absolute value of a SnugInt
+ *
+ * \details
+ * Checks TryAbs, the min of a signed Type has no absolute value in Type
+ *
+ * @tparam T SnugInt integer type
+ * @param item SnugInt to take the absolute value of
+ * @return |item|
+ */
+template<class T, class P>
+constexpr SnugInt<T, P> abs(const SnugInt<T, P> &item) noexcept(P::nothrow)
+{
+    return SnugInt<T, P>(SnugInt<T, P>::Resolve(SnugInt<T, P>::TryAbs(item.getValue())));
+}
+
+/**
+ * \brief SnugInt LT comparison operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Returns the less than comparison of left.value and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator<(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return left.value < right.value;
+}
+
+/**
+ * \brief SnugInt GT comparison operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Returns the greater than comparison of left.value and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator>(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return left.value > right.value;
+}
+
+/**
+ * \brief SnugInt EQ comparison operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Returns the equality comparison of left.value and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator==(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return left.value == right.value;
+}
+
+/**
+ * \brief SnugInt NEQ comparison operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Returns the non-equality comparison of left.value and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator!=(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return left.value != right.value;
+}
+
+/**
+ * \brief SnugInt GTEQ comparison operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Returns the greater than or equal comparison of left.value and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator>=(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return left.value >= right.value;
+}
+
+/**
+ * \brief SnugInt LTEQ comparison operator overload (SnugInt, SnugInt)
+ *
+ * \details
+ * Returns the less than or equal comparison of left.value and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator<=(const SnugInt<T, P> &left, const SnugInt<T, P> &right) noexcept
+{
+    return left.value <= right.value;
+}
+
+/**
+ * \brief SnugInt LT comparison operator overload (SnugInt, T)
+ *
+ * \details
+ * Returns the less than comparison of left.value and right
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right T to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator<(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return left.value < right;
+}
+
+/**
+ * \brief SnugInt GT comparison operator overload (SnugInt, T)
+ *
+ * \details
+ * Returns the greater than comparison of left.value and right
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right T to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator>(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return left.value > right;
+}
+
+/**
+ * \brief SnugInt EQ comparison operator overload (SnugInt, T)
+ *
+ * \details
+ * Returns the equality comparison of left.value and right
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right T to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator==(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return left.value == right;
+}
+
+/**
+ * \brief SnugInt NEQ comparison operator overload (SnugInt, T)
+ *
+ * \details
+ * Returns the non-equality comparison of left.value and right
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right T to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator!=(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return left.value != right;
+}
+
+/**
+ * \brief SnugInt GTEQ comparison operator overload (SnugInt, T)
+ *
+ * \details
+ * Returns the greater than or equal comparison of left.value and right
+ *
+ * @tparam T SnugInt integer type
+ * @param left SnugInt to be compared
+ * @param right T to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator>=(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return left.value >= right;
+}
+
+/**
+ * \brief SnugInt LTEQ comparison operator overload (SnugInt, T)
+ *
+ * \details
+ * Returns the less than or equal comparison of left.value and right
  *
  * @tparam T SnugInt integer type
  * @param left SnugInt to be compared
+ * @param right T to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator<=(const SnugInt<T, P> &left, const T &right) noexcept
+{
+    return left.value <= right;
+}
+
+/**
+ * \brief SnugInt LT comparison operator overload (T, SnugInt)
+ *
+ * \details
+ * Returns the less than comparison of left and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be compared
  * @param right SnugInt to be compared
  * @return resulting comparison bool
  */
-template<class T>
-bool operator!=(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class T, class P>
+constexpr bool operator<(const T &left, const SnugInt<T, P> &right) noexcept
 {
-    return left.value != right.value;
+    return left < right.value;
+}
+
+/**
+ * \brief SnugInt GT comparison operator overload (T, SnugInt)
+ *
+ * \details
+ * Returns the greater than comparison of left and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator>(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return left > right.value;
+}
+
+/**
+ * \brief SnugInt EQ comparison operator overload (T, SnugInt)
+ *
+ * \details
+ * Returns the equality comparison of left and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator==(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return left == right.value;
+}
+
+/**
+ * \brief SnugInt NEQ comparison operator overload (T, SnugInt)
+ *
+ * \details
+ * Returns the non-equality comparison of left and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator!=(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return left != right.value;
+}
+
+/**
+ * \brief SnugInt GTEQ comparison operator overload (T, SnugInt)
+ *
+ * \details
+ * Returns the greater than or equal comparison of left and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator>=(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return left >= right.value;
+}
+
+/**
+ * \brief SnugInt LTEQ comparison operator overload (T, SnugInt)
+ *
+ * \details
+ * Returns the less than or equal comparison of left and right.value
+ *
+ * @tparam T SnugInt integer type
+ * @param left T to be compared
+ * @param right SnugInt to be compared
+ * @return resulting comparison bool
+ */
+template<class T, class P>
+constexpr bool operator<=(const T &left, const SnugInt<T, P> &right) noexcept
+{
+    return left <= right.value;
+}
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief Writes item with the basefield, showbase and showpos of the stream
+     */
+    template<class T>
+    void StreamOut(std::ostream& os, T item, std::false_type)
+    {
+        os << +item; // + so 8 bit types print as numbers
+    }
+
+    /**
+     * \brief Writes a 128 bit item like the stream would, it has no inserter for them
+     */
+    template<class T>
+    void StreamOut(std::ostream& os, T item, std::true_type)
+    {
+        const std::ios_base::fmtflags flags = os.flags();
+        const std::ios_base::fmtflags base = flags & std::ios_base::basefield;
+        char buffer[48];        // 43 octal digits, the base and the terminator
+        char* end = buffer + sizeof(buffer) - 1;
+        char* p = end;
+        *end = '\0';
+
+        if (base == std::ios_base::oct || base == std::ios_base::hex)
+        {   // the two's complement bits, like the stream prints a negative long
+            const unsigned shift = base == std::ios_base::hex ? 4 : 3;
+            const char* digits = flags & std::ios_base::uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+            typename MakeUnsigned<T>::type bits = static_cast<typename MakeUnsigned<T>::type>(item);
+            do
+            {
+                *--p = digits[static_cast<unsigned>(bits) & ((1u << shift) - 1)];
+                bits >>= shift;
+            } while (bits != 0);
+
+            if ((flags & std::ios_base::showbase) && item != 0)
+            {
+                if (shift == 4)
+                    *--p = flags & std::ios_base::uppercase ? 'X' : 'x';
+                *--p = '0';
+            }
+        } else
+        {
+            p = buffer;
+            if ((flags & std::ios_base::showpos) && !IsNegative(item))
+                *p++ = '+';
+            *snug::to_chars(p, end, item).ptr = '\0';
+            p = buffer;
+        }
+
+        os << p;
+    }
+
+    /**
+     * \brief Reads an oct or hex item through the stream into the widest integral and range checks it
+     */
+    template<class T>
+    bool StreamIn(std::istream& is, T& item, std::false_type)
+    {
+        typename std::conditional<IsSigned<T>::value, long long, unsigned long long>::type wide = 0;
+        if (!(is >> wide))
+            return false;
+
+        const SnugIntResult<T> result = SnugInt<T, SnugIntWrapPolicy>::TryFrom(wide);
+        if (result.ok())
+            item = result.value;
+        return result.ok();
+    }
+
+    /**
+     * \brief Reads an oct or hex 128 bit item, an optional '-', a 0x prefix for hex and the digits
+     */
+    template<class T>
+    bool StreamIn(std::istream& is, T& item, std::true_type)
+    {
+        typedef typename MakeUnsigned<T>::type Unsigned;
+        const unsigned shift = (is.flags() & std::ios_base::basefield) == std::ios_base::hex ? 4 : 3;
+        std::streambuf* in = is.rdbuf();
+
+        int c = in->sgetc();
+        const bool negative = c == '-';
+        if (negative)
+            c = in->snextc();
+
+        Unsigned magnitude = 0;
+        bool digits = false;
+        bool overflow = false;
+        for (;; c = in->snextc())
+        {
+            unsigned digit = 16;
+            if (c >= '0' && c <= '9')
+                digit = static_cast<unsigned>(c - '0');
+            else if (c >= 'a' && c <= 'f')
+                digit = static_cast<unsigned>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F')
+                digit = static_cast<unsigned>(c - 'A' + 10);
+            else if (shift == 4 && (c == 'x' || c == 'X') && digits && magnitude == 0)
+            {   // 0x prefix
+                digits = false;
+                continue;
+            }
+
+            if (digit >= (1u << shift))
+                break;
+            overflow |= (magnitude >> (std::numeric_limits<Unsigned>::digits - shift)) != 0;
+            magnitude = static_cast<Unsigned>(magnitude << shift) | digit;
+            digits = true;
+        }
+        if (c == std::char_traits<char>::eof())
+            is.setstate(std::ios_base::eofbit);
+
+        const Unsigned limit = static_cast<Unsigned>(std::numeric_limits<T>::max()) + (negative && IsSigned<T>::value);
+        if (!digits || overflow || magnitude > (negative && !IsSigned<T>::value ? 0 : limit))
+            return false;
+
+        item = static_cast<T>(negative ? static_cast<Unsigned>(0 - magnitude) : magnitude);
+        return true;
+    }
+}
+}
+
+/**
+ * \brief operator overload for output buffer streams
+ *
+ * \details
+ * Decimal output goes through snug::to_chars and is written as one string, so width and fill still apply.
+ * Any other basefield or showpos is left to the stream, which 128 bit types imitate
+ *
+ * @tparam T SnugInt type
+ * @param os output stream
+ * @param data SnugInt that will be sent into the output stream
+ * @return the output stream
+ *
+ * \author Stephen Tafoya
+ * \date 3/8/2019
+ */
+template <class T, class P>
+std::ostream &operator<<(std::ostream &os, const SnugInt<T, P> &data)
+{
+    if ((os.flags() & std::ios_base::basefield) != std::ios_base::oct && (os.flags() & std::ios_base::basefield) != std::ios_base::hex
+        && !(os.flags() & std::ios_base::showpos))
+    {
+        char buffer[snug::max_chars + 1];
+        *snug::to_chars(buffer, buffer + snug::max_chars, data.value).ptr = '\0';
+        return os << buffer;
+    }
+
+    snug::detail::StreamOut(os, data.value, std::integral_constant<bool, (sizeof(T) > 8)>());
+    return os;
+}
+
+/**
+ * \brief operator overload for input buffer streams
+ *
+ * \details
+ * Skips whitespace, then reads an optional '-' and the digits that follow and parses them with
+ * snug::from_chars. Text that is not a number or does not fit in Type sets failbit and leaves data
+ * untouched. An oct or hex basefield is read through the stream into the widest integral and range checked,
+ * 128 bit types read their digits themselves
+ *
+ * @tparam T SnugInt type
+ * @param is input stream
+ * @param data SnugInt that will be sent into by the input stream
+ * @return the input stream
+ *
+ * \author Stephen Tafoya
+ * \date 3/8/2019
+ */
+template <class T, class P>
+std::istream &operator>>(std::istream &is, SnugInt<T, P> &data)
+{
+    const std::istream::sentry sentry(is);
+    if (!sentry)
+        return is;
+
+    if ((is.flags() & std::ios_base::basefield) == std::ios_base::oct || (is.flags() & std::ios_base::basefield) == std::ios_base::hex)
+    {
+        T item = 0;
+        if (snug::detail::StreamIn(is, item, std::integral_constant<bool, (sizeof(T) > 8)>()))
+            data.value = item;
+        else
+            is.setstate(std::ios_base::failbit);
+        return is;
+    }
+
+    // sign (a '+' is skipped like std::num_get does, from_chars takes none), one zero standing for any
+    // leading zeros and the digits after them, longer only overflows
+    char buffer[snug::max_chars + 2];
+    std::size_t length = 0;
+    bool overlong = false;
+    std::streambuf* in = is.rdbuf();
+    int c = in->sgetc();
+    if (c == '-')
+    {
+        buffer[length++] = '-';
+        c = in->snextc();
+    }
+    else if (c == '+')
+        c = in->snextc();
+    if (c == '0')
+    {
+        buffer[length++] = '0';
+        while (c == '0')
+            c = in->snextc();
+    }
+    for (; c != std::char_traits<char>::eof() && c >= '0' && c <= '9'; c = in->snextc())
+    {
+        if (length < sizeof(buffer))
+            buffer[length++] = static_cast<char>(c);
+        else
+            overlong = true;
+    }
+    if (c == std::char_traits<char>::eof())
+        is.setstate(std::ios_base::eofbit);
+
+    T item = 0;
+    const snug::FromCharsResult result = snug::from_chars(buffer, buffer + length, item);
+    if (overlong || !result.ok() || result.ptr != buffer + length)
+        is.setstate(std::ios_base::failbit);
+    else
+        data.value = item;
+    return is;
+}
+
+/**
+ * \brief Adds two SnugInts together without throwing
+ *
+ * \details
+ * TryAdd uses the checked arithmetic backend to determine
+ * if it is safe to add the left value to the right value
+ *
+ * @param left value to be added to right
+ * @param right value to be added to left
+ * @return the Sum of left and right, or AdditionOverflow / AdditionUnderflow
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryAdd(Type left, Type right) noexcept
+{
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (snug::detail::AddOverflow(left, right, &result.value))
+    {   // only a positive right side can push the sum past max
+        result.error = right > 0 ? SnugIntError::AdditionOverflow : SnugIntError::AdditionUnderflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Add, result);
+}
+
+/**
+ * \brief TryAdd on the raw values of two SnugInts
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryAdd(const SnugInt<Type, Policy> &left, const SnugInt<Type, Policy> &right) noexcept
+{
+    return TryAdd(left.value, right.value);
+}
+
+/**
+ * \brief Subtracts a SnugInt from another SnugInt without throwing
+ *
+ * \details
+ * TrySub uses the checked arithmetic backend to determine
+ * if it is safe to subtract the right from the left
+ *
+ * @param left value to be subtracted from
+ * @param right value to subtract
+ * @return the difference of left minus right, or SubtractionOverflow / SubtractionUnderflow
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TrySub(Type left, Type right) noexcept
+{
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (snug::detail::SubOverflow(left, right, &result.value))
+    {   // only a negative right side can push the difference past max
+        result.error = right < 0 ? SnugIntError::SubtractionOverflow : SnugIntError::SubtractionUnderflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Sub, result);
+}
+
+/**
+ * \brief TrySub on the raw values of two SnugInts
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TrySub(const SnugInt<Type, Policy> &left, const SnugInt<Type, Policy> &right) noexcept
+{
+    return TrySub(left.value, right.value);
+}
+
+/**
+ * \brief Multiplies two SnugInts together without throwing
+ *
+ * \details
+ * TryMult uses the checked arithmetic backend to determine
+ * if it is safe to multiply the left and right
+ *
+ * @param left value to be multiplied
+ * @param right value to be multiplied
+ * @return the product of left and right, or MultiplicationOverflow / MultiplicationUnderflow
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryMult(Type left, Type right) noexcept
+{
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (snug::detail::MultOverflow(left, right, &result.value))
+    {   // operands with matching signs give a positive product
+        result.error = (left < 0) == (right < 0) ? SnugIntError::MultiplicationOverflow
+                                                             : SnugIntError::MultiplicationUnderflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Mult, result);
+}
+
+/**
+ * \brief TryMult on the raw values of two SnugInts
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryMult(const SnugInt<Type, Policy> &left, const SnugInt<Type, Policy> &right) noexcept
+{
+    return TryMult(left.value, right.value);
 }
 
 /**
- * \brief SnugInt GTEQ comparison operator overload (SnugInt, SnugInt)
+ * \brief Divides a SnugInt by another SnugInt without throwing
  *
  * \details
- * Returns the greater than or equal comparison of left.value and right.value
+ * TryDiv checks for a zero divisor and for min / -1, the only quotient that does not fit a signed Type.
+ * A positive divisor can fail neither check, so the common case costs a single compare
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @param left to be divided by right
+ * @param right the divisor
+ * @return resulting division, or DivisionByZero / DivisionOverflow
  */
-template<class T>
-bool operator>=(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryDiv(Type left, Type right) noexcept
 {
-    return left.value >= right.value;
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+
+    if (right > 0)
+        result.value = static_cast<Type>(left / right);
+    else if (right == 0)
+        result.error = SnugIntError::DivisionByZero;
+    else if (left == min && right == static_cast<Type>(-1))
+    {   // -min is one past max, the wrapped quotient is min itself
+        result.value = min;
+        result.error = SnugIntError::DivisionOverflow;
+    } else
+        result.value = static_cast<Type>(left / right);
+
+    return snug::detail::Record(SnugIntOperation::Div, result);
 }
 
 /**
- * \brief SnugInt LTEQ comparison operator overload (SnugInt, SnugInt)
- *
- * \details
- * Returns the less than or equal comparison of left.value and right.value
- *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * \brief TryDiv on the raw values of two SnugInts
  */
-template<class T>
-bool operator<=(const SnugInt<T> &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryDiv(const SnugInt<Type, Policy> &left, const SnugInt<Type, Policy> &right) noexcept
 {
-    return left.value <= right.value;
+    return TryDiv(left.value, right.value);
 }
 
 /**
- * \brief SnugInt LT comparison operator overload (SnugInt, T)
+ * \brief Takes the remainder of a SnugInt divided by another SnugInt without throwing
  *
  * \details
- * Returns the less than comparison of left.value and right
+ * TryMod checks for a zero divisor, min % -1 is 0 and is computed without the
+ * division that would overflow. A positive divisor costs a single compare
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right T to be compared
- * @return resulting comparison bool
+ * @param left to be divided by right
+ * @param right the divisor
+ * @return the remainder of left / right, or DivisionByZero
  */
-template<class T>
-bool operator<(const SnugInt<T> &left, const T &right)
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryMod(Type left, Type right) noexcept
 {
-    return left.value < right;
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+
+    if (right > 0)
+        result.value = static_cast<Type>(left % right);
+    else if (right == 0)
+        result.error = SnugIntError::DivisionByZero;
+    else if (right != static_cast<Type>(-1))
+        result.value = static_cast<Type>(left % right);
+
+    return snug::detail::Record(SnugIntOperation::Div, result);
 }
 
 /**
- * \brief SnugInt GT comparison operator overload (SnugInt, T)
+ * \brief TryMod on the raw values of two SnugInts
+ */
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryMod(const SnugInt<Type, Policy> &left, const SnugInt<Type, Policy> &right) noexcept
+{
+    return TryMod(left.value, right.value);
+}
+
+/**
+ * \brief Negates a value without throwing
  *
  * \details
- * Returns the greater than comparison of left.value and right
+ * For a signed Type only min fails, -min is one past max and the wrapped result is min itself.
+ * For an unsigned Type every value but 0 fails, the wrapped result is the two's complement
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right T to be compared
- * @return resulting comparison bool
+ * @param item value to negate
+ * @return -item, or NegationOverflow / NegationUnderflow
  */
-template<class T>
-bool operator>(const SnugInt<T> &left, const T &right)
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryNegate(Type item) noexcept
 {
-    return left.value > right;
+    SnugIntResult<Type> result = {static_cast<Type>(0 - static_cast<typename snug::detail::MakeUnsigned<Type>::type>(item)),
+                                  SnugIntError::None};
+
+    if (snug::detail::IsSigned<Type>::value ? item == min : item != 0)
+        result.error = snug::detail::IsSigned<Type>::value ? SnugIntError::NegationOverflow : SnugIntError::NegationUnderflow;
+
+    return snug::detail::Record(SnugIntOperation::Negate, result);
 }
 
 /**
- * \brief SnugInt EQ comparison operator overload (SnugInt, T)
+ * \brief Absolute value without throwing
  *
  * \details
- * Returns the equality comparison of left.value and right
+ * Only the min of a signed Type fails, with NegationOverflow and min as the wrapped result
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right T to be compared
- * @return resulting comparison bool
+ * @param item value to take the absolute value of
+ * @return |item|, or NegationOverflow
  */
-template<class T>
-bool operator==(const SnugInt<T> &left, const T &right)
+template<class Type, class Policy>
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryAbs(Type item) noexcept
 {
-    return left.value == right;
+    SnugIntResult<Type> result = {item, SnugIntError::None};
+
+    if (snug::detail::IsNegative(item))
+    {   // -min wraps to min itself
+        result.value = static_cast<Type>(0 - static_cast<typename snug::detail::MakeUnsigned<Type>::type>(item));
+        if (item == min)
+            result.error = SnugIntError::NegationOverflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Negate, result);
 }
 
 /**
- * \brief SnugInt NEQ comparison operator overload (SnugInt, T)
+ * \brief Shifts item left without throwing
  *
  * \details
- * Returns the non-equality comparison of left.value and right
- *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right T to be compared
- * @return resulting comparison bool
+ * The shift is done on the unsigned representation, it fails when shifting the result back
+ * does not give item again, which catches both lost bits and a changed sign. The value is always
+ * the shift by the count masked to the width, as the hardware does, so it never depends on the check
+ *
+ * @tparam T integral type of the shift count
+ * @param item value to be shifted
+ * @param shift number of bits, must be in [0, width of Type)
+ * @return item * 2^shift, or ShiftOutOfRange / ShiftOverflow / ShiftUnderflow
  */
+template<class Type, class Policy>
 template<class T>
-bool operator!=(const SnugInt<T> &left, const T &right)
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryShiftLeft(Type item, const T &shift) noexcept
 {
-    return left.value != right;
+    static_assert(snug::detail::IsInteger<T>::value, "SnugInt shift count must be an integral.");
+    typedef typename snug::detail::MakeUnsigned<Type>::type Bits;
+    constexpr unsigned width = sizeof(Type) * CHAR_BIT;
+
+    // the count is compared in its own unsigned type so a 128 bit count is not truncated first, the
+    // negative test is or'ed in without a branch and folds into the same unsigned compare. The masked
+    // count keeps the shift itself defined so the checks below need no branch
+    const bool range = snug::detail::IsNegative(shift) | (static_cast<typename snug::detail::MakeUnsigned<T>::type>(shift) >= width);
+    const unsigned count = static_cast<unsigned>(shift) & (width - 1);
+    const Type shifted = static_cast<Type>(static_cast<Bits>(static_cast<Bits>(item) << count));
+    const bool lost = static_cast<Type>(shifted >> count) != item;
+
+    const SnugIntError lost_error = snug::detail::IsNegative(item) ? SnugIntError::ShiftUnderflow : SnugIntError::ShiftOverflow;
+    SnugIntResult<Type> result = {shifted, range ? SnugIntError::ShiftOutOfRange : (lost ? lost_error : SnugIntError::None)};
+    return snug::detail::Record(SnugIntOperation::Shift, result);
 }
 
 /**
- * \brief SnugInt GTEQ comparison operator overload (SnugInt, T)
+ * \brief Shifts item right without throwing
  *
  * \details
- * Returns the greater than or equal comparison of left.value and right
+ * A right shift never loses magnitude, only the shift count is checked. The value is always
+ * the shift by the count masked to the width, like TryShiftLeft
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right T to be compared
- * @return resulting comparison bool
+ * @tparam T integral type of the shift count
+ * @param item value to be shifted
+ * @param shift number of bits, must be in [0, width of Type)
+ * @return item / 2^shift rounded towards negative infinity, or ShiftOutOfRange
  */
+template<class Type, class Policy>
 template<class T>
-bool operator>=(const SnugInt<T> &left, const T &right)
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryShiftRight(Type item, const T &shift) noexcept
 {
-    return left.value >= right;
+    static_assert(snug::detail::IsInteger<T>::value, "SnugInt shift count must be an integral.");
+
+    constexpr unsigned width = sizeof(Type) * CHAR_BIT;
+
+    // same range check and masked count as TryShiftLeft
+    const bool range = snug::detail::IsNegative(shift) | (static_cast<typename snug::detail::MakeUnsigned<T>::type>(shift) >= width);
+    const unsigned count = static_cast<unsigned>(shift) & (width - 1);
+
+    SnugIntResult<Type> result = {static_cast<Type>(item >> count), range ? SnugIntError::ShiftOutOfRange : SnugIntError::None};
+    return snug::detail::Record(SnugIntOperation::Shift, result);
 }
 
 /**
- * \brief SnugInt LTEQ comparison operator overload (SnugInt, T)
+ * \brief Converts an unknown item T to Type without throwing
  *
  * \details
- * Returns the less than or equal comparison of left.value and right
+ * Requires that T is a numerical value, reports SizeMismatch if it does not fit into Type.
+ * Built on snug_try_cast, the check is picked at compile time
  *
- * @tparam T SnugInt integer type
- * @param left SnugInt to be compared
- * @param right T to be compared
- * @return resulting comparison bool
+ * @tparam T unknown item type
+ * @param item value to be converted
+ * @return the converted value, or SizeMismatch
  */
+template<class Type, class Policy>
 template<class T>
-bool operator<=(const SnugInt<T> &left, const T &right)
+constexpr SnugIntResult<Type> SnugInt<Type, Policy>::TryFrom(const T &item) noexcept
 {
-    return left.value <= right;
+    static_assert(snug::detail::IsInteger<T>::value, "Cannot assign SnugInt to a non integral type.");
+
+    return snug_try_cast<Type>(item);
 }
 
 /**
- * \brief SnugInt LT comparison operator overload (T, SnugInt)
+ * \brief Converts an integral or SnugInt to To without throwing
  *
  * \details
- * Returns the less than comparison of left and right.value
- *
- * @tparam T SnugInt integer type
- * @param left T to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * The range check is chosen at compile time from the ranges of both types: none when every From fits,
+ * otherwise a single unsigned compare (see snug::detail::CastCheck)
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugIntResult<std::uint16_t> port = snug_try_cast<std::uint16_t>(parsed);
+ * \endcode
+ * @tparam To integral or SnugInt to convert to
+ * @tparam From integral or SnugInt to convert from
+ * @param item value to convert
+ * @return the converted value, or the truncated value and SizeMismatch
  */
-template<class T>
-bool operator<(const T &left, const SnugInt<T> &right)
+template<class To, class From>
+constexpr SnugIntResult<typename snug::detail::CastTarget<To>::Type> snug_try_cast(const From& item) noexcept
 {
-    return left < right.value;
+    typedef typename snug::detail::CastTarget<To>::Type Type;
+    typedef decltype(snug::detail::CastSource(item)) Source;
+    static_assert(snug::detail::IsInteger<Source>::value, "snug_try_cast converts integrals and SnugInts only");
+
+    const Source source = snug::detail::CastSource(item);
+    const SnugIntResult<Type> result = {static_cast<Type>(source),
+                                        snug::detail::Fits<Type>(source) ? SnugIntError::None : SnugIntError::SizeMismatch};
+
+    // a Type always fits, converting from one is not a check
+    return std::is_same<Source, Type>::value ? result : snug::detail::Record(SnugIntOperation::Convert, result);
 }
 
 /**
- * \brief SnugInt GT comparison operator overload (T, SnugInt)
+ * \brief Converts an integral or SnugInt to To
  *
  * \details
- * Returns the greater than comparison of left and right.value
- *
- * @tparam T SnugInt integer type
- * @param left T to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * A value that does not fit goes to the Policy of To (SnugIntThrowPolicy for a raw integral) with the
+ * bound on the side of item as the saturated value
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *std::int8_t level = snug_cast<std::int8_t>(reading);                        // throws SnugInt_Size_Mismatch_Exception
+ *SnugInt<std::uint8_t, SnugIntSaturatePolicy> pixel = snug_cast<SnugInt<std::uint8_t, SnugIntSaturatePolicy>>(-4); // 0
+ * \endcode
+ * @tparam To integral or SnugInt to convert to
+ * @tparam From integral or SnugInt to convert from
+ * @param item value to convert
+ * @return the converted value, or what the Policy of To decides
  */
-template<class T>
-bool operator>(const T &left, const SnugInt<T> &right)
+template<class To, class From>
+constexpr To snug_cast(const From& item) noexcept(snug::detail::CastTarget<To>::Policy::nothrow)
 {
-    return left > right.value;
+    typedef snug::detail::CastTarget<To> Target;
+    typedef typename Target::Type Type;
+
+    return Target::Make(SnugInt<Type, typename Target::Policy>::Resolve(snug_try_cast<Type>(item),
+            snug::detail::IsNegative(snug::detail::CastSource(item)) ? std::numeric_limits<Type>::min()
+                                                                      : std::numeric_limits<Type>::max()));
 }
 
 /**
- * \brief SnugInt EQ comparison operator overload (T, SnugInt)
+ * \brief Adds two integrals of any types without throwing
  *
  * \details
- * Returns the equality comparison of left and right.value
+ * The exact sum is checked against Type, the sign of the exact sum tells overflow from underflow
  *
- * @tparam T SnugInt integer type
- * @param left T to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @tparam L integral type of left
+ * @tparam R integral type of right
+ * @param left value to be added to right
+ * @param right value to be added to left
+ * @return the Sum of left and right, or AdditionOverflow / AdditionUnderflow
  */
-template<class T>
-bool operator==(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class L, class R>
+constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> SnugInt<Type, Policy>::TryAdd(L left, R right) noexcept
 {
-    return left == right.value;
+    typedef typename snug::detail::ExactMagnitude<L, R>::type Magnitude;
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (snug::detail::MixedAddOverflow(left, right, &result.value))
+    {
+        result.error = snug::detail::ExactAdd(snug::detail::ExactOf<L, Magnitude>(left),
+                                              snug::detail::ExactOf<R, Magnitude>(right)).negative
+                       ? SnugIntError::AdditionUnderflow : SnugIntError::AdditionOverflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Add, result);
 }
 
 /**
- * \brief SnugInt NEQ comparison operator overload (T, SnugInt)
- *
- * \details
- * Returns the non-equality comparison of left and right.value
+ * \brief Subtracts two integrals of any types without throwing
  *
- * @tparam T SnugInt integer type
- * @param left T to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @tparam L integral type of left
+ * @tparam R integral type of right
+ * @param left value to be subtracted from
+ * @param right value to subtract
+ * @return the difference of left minus right, or SubtractionOverflow / SubtractionUnderflow
  */
-template<class T>
-bool operator!=(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class L, class R>
+constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> SnugInt<Type, Policy>::TrySub(L left, R right) noexcept
 {
-    return left != right.value;
+    typedef typename snug::detail::ExactMagnitude<L, R>::type Magnitude;
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (snug::detail::MixedSubOverflow(left, right, &result.value))
+    {
+        result.error = snug::detail::ExactAdd(snug::detail::ExactOf<L, Magnitude>(left),
+                                              snug::detail::ExactNegate(snug::detail::ExactOf<R, Magnitude>(right))).negative
+                       ? SnugIntError::SubtractionUnderflow : SnugIntError::SubtractionOverflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Sub, result);
 }
 
 /**
- * \brief SnugInt GTEQ comparison operator overload (T, SnugInt)
+ * \brief Multiplies two integrals of any types without throwing
  *
- * \details
- * Returns the greater than or equal comparison of left and right.value
+ * @tparam L integral type of left
+ * @tparam R integral type of right
+ * @param left value to be multiplied
+ * @param right value to be multiplied
+ * @return the product of left and right, or MultiplicationOverflow / MultiplicationUnderflow
+ */
+template<class Type, class Policy>
+template<class L, class R>
+constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> SnugInt<Type, Policy>::TryMult(L left, R right) noexcept
+{
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (snug::detail::MixedMultOverflow(left, right, &result.value))
+    {   // operands with matching signs give a positive product
+        result.error = snug::detail::IsNegative(left) == snug::detail::IsNegative(right)
+                       ? SnugIntError::MultiplicationOverflow : SnugIntError::MultiplicationUnderflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Mult, result);
+}
+
+/**
+ * \brief Divides two integrals of any types without throwing
  *
- * @tparam T SnugInt integer type
- * @param left T to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @tparam L integral type of left
+ * @tparam R integral type of right
+ * @param left to be divided by right
+ * @param right the divisor
+ * @return resulting division, or DivisionByZero / DivisionOverflow / DivisionUnderflow
  */
-template<class T>
-bool operator>=(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class L, class R>
+constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> SnugInt<Type, Policy>::TryDiv(L left, R right) noexcept
 {
-    return left >= right.value;
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (right == 0)
+        result.error = SnugIntError::DivisionByZero;
+    else if (snug::detail::MixedDivOverflow(left, right, &result.value))
+    {
+        result.error = snug::detail::IsNegative(left) != snug::detail::IsNegative(right)
+                       ? SnugIntError::DivisionUnderflow : SnugIntError::DivisionOverflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Div, result);
 }
 
 /**
- * \brief SnugInt LTEQ comparison operator overload (T, SnugInt)
+ * \brief Takes the remainder of two integrals of any types without throwing
  *
  * \details
- * Returns the less than or equal comparison of left and right.value
+ * The remainder has the sign of left and is computed without the division that would overflow,
+ * so min % -1 is 0. It only fails to fit Type when it is negative and Type is unsigned
  *
- * @tparam T SnugInt integer type
- * @param left T to be compared
- * @param right SnugInt to be compared
- * @return resulting comparison bool
+ * @tparam L integral type of left
+ * @tparam R integral type of right
+ * @param left to be divided by right
+ * @param right the divisor
+ * @return the remainder of left / right, or DivisionByZero / DivisionUnderflow
  */
-template<class T>
-bool operator<=(const T &left, const SnugInt<T> &right)
+template<class Type, class Policy>
+template<class L, class R>
+constexpr snug::detail::EnableMixed<Type, L, R, SnugIntResult<Type>> SnugInt<Type, Policy>::TryMod(L left, R right) noexcept
 {
-    return left <= right.value;
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    if (right == 0)
+        result.error = SnugIntError::DivisionByZero;
+    else if (snug::detail::MixedModOverflow(left, right, &result.value))
+    {
+        result.error = snug::detail::IsNegative(left) ? SnugIntError::DivisionUnderflow : SnugIntError::DivisionOverflow;
+    }
+
+    return snug::detail::Record(SnugIntOperation::Div, result);
 }
 
 /**
- * \brief operator overload for output buffer streams
+ * \brief Resolves a SnugIntResult through the Policy
  *
  * \details
- * Attempts to output the value of value
- *
- * @tparam T SnugInt type
- * @param os output stream
- * @param data SnugInt that will be sent into the output stream
- * @return the output stream
+ * Hands the error of a failed result to Policy, saturating towards
+ * max for overflow errors and towards min for underflow errors
  *
- * \author Stephen Tafoya
- * \date 3/8/2019
+ * @param result result of one of the Try methods
+ * @return the value of result, or whatever Policy decides for a failed result
  */
-template <class T>
-std::ostream &operator<<(std::ostream &os, const SnugInt<T> &data)
+template<class Type, class Policy>
+constexpr Type SnugInt<Type, Policy>::Resolve(const SnugIntResult<Type> &result) noexcept(Policy::nothrow)
 {
-    os << data.value;
-    return os;
+#if SNUGINT_MODE != SNUGINT_MODE_CHECKED
+    return Resolve(result, result.value);
+#else
+    if (SNUGINT_LIKELY(result.ok()))
+        return result.value;
+
+    switch (result.error)
+    {
+        case SnugIntError::AdditionUnderflow:
+        case SnugIntError::SubtractionUnderflow:
+        case SnugIntError::MultiplicationUnderflow:
+        case SnugIntError::ShiftUnderflow:
+        case SnugIntError::DivisionUnderflow:
+        case SnugIntError::NegationUnderflow:
+            return Resolve(result, min);
+        default:
+            return Resolve(result, max);
+    }
+#endif
 }
 
 /**
- * \brief operator overload for input buffer streams
+ * \brief Resolves a SnugIntResult through the Policy
  *
  * \details
- * Attempts to get the input for value
- *
- * @tparam T SnugInt type
- * @param is input stream
- * @param data SnugInt that will be sent into by the input stream
- * @return the input stream
+ * Hands the error of a failed result to Policy along with the value to saturate to.
+ * In SNUGINT_MODE_ASSUME and SNUGINT_MODE_UNCHECKED the Policy is never consulted, see SnugIntBackend.h
  *
- * \author Stephen Tafoya
- * \date 3/8/2019
+ * @param result result of one of the Try methods
+ * @param saturated the closest value to the real result that fits in Type
+ * @return the value of result, or whatever Policy decides for a failed result
  */
-template <class T>
-std::istream &operator>>(std::istream &is, const SnugInt<T> &data)
+template<class Type, class Policy>
+constexpr Type SnugInt<Type, Policy>::Resolve(const SnugIntResult<Type> &result, Type saturated) noexcept(Policy::nothrow)
 {
-    is >> data.value;
-    return is;
+#if SNUGINT_MODE == SNUGINT_MODE_ASSUME
+    SNUGINT_ASSUME(result.ok());
+    static_cast<void>(saturated);
+    return result.value;
+#elif SNUGINT_MODE == SNUGINT_MODE_UNCHECKED
+    static_cast<void>(saturated);
+    return result.value;
+#else
+    if (SNUGINT_LIKELY(result.ok()))
+        return result.value;
+
+    snug::detail::ProfileError(result.error);
+    return Policy::template OnError<Type>(result.error, result.value, saturated);
+#endif
 }
 
 /**
  * \brief Safely adds two SnugInts together
  *
  * \details
- * SafeAdd performs the proper precondition checks to determine
- * if it is safe to add the left value to the right value
+ * SafeAdd performs the checks of TryAdd
  *
  * \details
  * a <b>SNUGINT_ADD_EXCEPTION</b> will be thrown if it is determined that overflow will occur
@@ -885,24 +2596,10 @@ std::istream &operator>>(std::istream &is, const SnugInt<T> &data)
  * \author Stephen Tafoya
  * \date 3/8/2019
  */
-template<class Type>
-SnugInt<Type> SnugInt<Type>::SafeAdd(const SnugInt<Type> &left, const SnugInt<Type> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy> SnugInt<Type, Policy>::SafeAdd(Type left, Type right) noexcept(Policy::nothrow)
 {
-    if (left.value > 0 && right.value > 0)
-    {   // Operation: + + + = +
-        if (left.max - left.value < right.value)
-        {   // throw if overflow will occur
-            throw snugint_add_overflow;
-        }
-    } else if (left.value < 0 && right.value < 0)
-    {   // Operation: - + - = -
-        if (left.min - left.value > right.value)
-        {   // throw if underflow will occur
-            throw snugint_add_underflow;
-        }
-    }
-
-    SnugInt<Type> temp(left.value + right.value);
+    SnugInt<Type, Policy> temp(RawTag(), Resolve(TryAdd(left, right)));
 
     return temp;
 }
@@ -910,8 +2607,7 @@ SnugInt<Type> SnugInt<Type>::SafeAdd(const SnugInt<Type> &left, const SnugInt<Ty
  * \brief Safely subtracts a SnugInt from another SnugInt
  *
  * \details
- * SafeSub performs the proper precondition checks to determine
- * if it is safe to subtract the right from the left
+ * SafeSub performs the checks of TrySub
  *
  * \details
  * a <b>SNUGINT_SUB_EXCEPTION</b> will be thrown if it is determined underflow or overflow will occur
@@ -923,24 +2619,10 @@ SnugInt<Type> SnugInt<Type>::SafeAdd(const SnugInt<Type> &left, const SnugInt<Ty
  * \author Stephen Tafoya
  * \date 3/8/2019
  */
-template<class Type>
-SnugInt<Type> SnugInt<Type>::SafeSub(const SnugInt<Type> &left, const SnugInt<Type> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy> SnugInt<Type, Policy>::SafeSub(Type left, Type right) noexcept(Policy::nothrow)
 {
-    if (left.value > 0 && right.value < 0)
-    {   // Operation: + - - = +
-        if (left.max - left.value < abs(right.value))
-        {   // thrown if overflow will occur
-            throw snugint_sub_overflow;
-        }
-    } else if (left.value < 0 && right.value > 0)
-    {   // Operation: - - + = -
-        if (abs(left.min - left.value) < right.value)
-        {   // thrown if underflow will occur
-            throw snugint_sub_underflow;
-        }
-    }
-
-    SnugInt<Type> temp(left.value - right.value);
+    SnugInt<Type, Policy> temp(RawTag(), Resolve(TrySub(left, right)));
 
     return temp;
 }
@@ -949,8 +2631,7 @@ SnugInt<Type> SnugInt<Type>::SafeSub(const SnugInt<Type> &left, const SnugInt<Ty
  * \brief Safely multiplies two SnugInts together
  *
  * \details
- * SafeMult performs the proper precondition checks to determine
- * if it is safe to multiply the left and right
+ * SafeMult performs the checks of TryMult
  *
  * \details
  * a <b>SNUGINT_MULT_EXECPTION</b> will be thrown if it is determined overflow will occur
@@ -962,42 +2643,10 @@ SnugInt<Type> SnugInt<Type>::SafeSub(const SnugInt<Type> &left, const SnugInt<Ty
  * \author Stephen Tafoya
  * \date 3/8/2019
  */
-template<class Type>
-SnugInt<Type> SnugInt<Type>::SafeMult(const SnugInt<Type> &left, const SnugInt<Type> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy> SnugInt<Type, Policy>::SafeMult(Type left, Type right) noexcept(Policy::nothrow)
 {
-    if (left.value > 0)
-    {
-        if (right.value > 0)
-        {   // Operands: + * + = +
-            if (left.value > (left.max / right.value))
-            {   // thrown if multiplication will cause overflow
-                throw snugint_mult_overflow;
-            }
-        } else
-        {   // Operands: + * - = -
-            if (right.value < (left.min / left.value))
-            {   // thrown if multiplication will cause underflow
-                throw snugint_mult_underflow;
-            }
-        }
-    } else
-    {
-        if (right.value > 0)
-        {   // Operands: - * + = -
-            if (left.value < (left.min / right.value))
-            {   // thrown if multiplication will cause underflow
-                throw snugint_mult_underflow;
-            }
-        } else
-        {   // Operands: - * - = +
-            if ((left.value != 0) && (right.value < (left.max / left.value)))
-            {   // called if multiplication will cause overflow
-                throw snugint_mult_overflow;
-            }
-        }
-    }
-
-    SnugInt<Type> temp(left.value * right.value);
+    SnugInt<Type, Policy> temp(RawTag(), Resolve(TryMult(left, right)));
 
     return temp;
 }
@@ -1006,7 +2655,7 @@ SnugInt<Type> SnugInt<Type>::SafeMult(const SnugInt<Type> &left, const SnugInt<T
  * \brief Divide a SnugInt by another SnugInt
  *
  * \details
- * SafeDiv does nothing special other than dividing left by right
+ * SafeDiv performs the checks of TryDiv
  *
  * @param left to be divided by right
  * @param right the divisor
@@ -1015,9 +2664,142 @@ SnugInt<Type> SnugInt<Type>::SafeMult(const SnugInt<Type> &left, const SnugInt<T
  * \author Stephen Tafoya
  * \date 3/8/2019
  */
-template<class Type>
-SnugInt<Type> SnugInt<Type>::SafeDiv(const SnugInt<Type> &left, const SnugInt<Type> &right)
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy> SnugInt<Type, Policy>::SafeDiv(Type left, Type right) noexcept(Policy::nothrow)
+{
+    SnugInt<Type, Policy> temp(RawTag(), Resolve(TryDiv(left, right)));
+    return temp;
+}
+
+/**
+ * \brief Remainder of a SnugInt divided by another SnugInt
+ *
+ * \details
+ * SafeMod performs the checks of TryMod
+ *
+ * @param left to be divided by right
+ * @param right the divisor
+ * @return the remainder of left / right
+ */
+template<class Type, class Policy>
+constexpr SnugInt<Type, Policy> SnugInt<Type, Policy>::SafeMod(Type left, Type right) noexcept(Policy::nothrow)
 {
-    SnugInt<Type> temp(left.value / right.value);
+    SnugInt<Type, Policy> temp(RawTag(), Resolve(TryMod(left, right)));
     return temp;
-}
\ No newline at end of file
+}
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief Throws an Exception, one out of line stub per exception type
+     *
+     * \details
+     * Cold and never inlined, the allocation and the throw stay out of the code of the caller. Without
+     * exceptions it aborts instead
+     */
+    template<class Exception>
+    [[noreturn]] SNUGINT_COLD void Raise()
+    {
+#if SNUGINT_HAS_EXCEPTIONS
+        throw Exception();
+#else
+        std::abort();
+#endif
+    }
+}
+}
+
+/**
+ * \brief Throws the SnugInt exception matching error
+ *
+ * \details
+ * Bridges the non throwing Try methods and the exception style operators,
+ * does nothing for SnugIntError::None
+ *
+ * @param error the error to be thrown
+ */
+inline void SnugIntThrow(SnugIntError error)
+{
+    if (error != SnugIntError::None)
+        SnugIntRaise(error);
+}
+
+/**
+ * \brief Throws the SnugInt exception matching a failed error
+ *
+ * \details
+ * The shared failure path of SnugIntThrowPolicy, cold and never inlined so an inlined operator only
+ * keeps its check and a call. Every case jumps to the Raise stub of its exception
+ *
+ * @param error the error to be thrown, never SnugIntError::None
+ */
+[[noreturn]] SNUGINT_COLD inline void SnugIntRaise(SnugIntError error)
+{
+    switch (error)
+    {
+        case SnugIntError::AdditionOverflow:
+            snug::detail::Raise<SnugInt_Addition_Overflow_Exception>();
+        case SnugIntError::AdditionUnderflow:
+            snug::detail::Raise<SnugInt_Addition_Underflow_Exception>();
+        case SnugIntError::SubtractionOverflow:
+            snug::detail::Raise<SnugInt_Subtraction_Overflow_Exception>();
+        case SnugIntError::SubtractionUnderflow:
+            snug::detail::Raise<SnugInt_Subtraction_Underflow_Exception>();
+        case SnugIntError::MultiplicationOverflow:
+            snug::detail::Raise<SnugInt_Multiplication_Overflow_Exception>();
+        case SnugIntError::MultiplicationUnderflow:
+            snug::detail::Raise<SnugInt_Multiplication_Underflow_Exception>();
+        case SnugIntError::SizeMismatch:
+            snug::detail::Raise<SnugInt_Size_Mismatch_Exception>();
+        case SnugIntError::TypeMismatch:
+            snug::detail::Raise<SnugInt_Type_Mismatch_Exception>();
+        case SnugIntError::DivisionByZero:
+            snug::detail::Raise<SnugInt_Division_By_Zero_Exception>();
+        case SnugIntError::DivisionOverflow:
+            snug::detail::Raise<SnugInt_Division_Overflow_Exception>();
+        case SnugIntError::DivisionUnderflow:
+            snug::detail::Raise<SnugInt_Division_Underflow_Exception>();
+        case SnugIntError::ShiftOutOfRange:
+            snug::detail::Raise<SnugInt_Shift_Range_Exception>();
+        case SnugIntError::ShiftOverflow:
+            snug::detail::Raise<SnugInt_Shift_Overflow_Exception>();
+        case SnugIntError::ShiftUnderflow:
+            snug::detail::Raise<SnugInt_Shift_Underflow_Exception>();
+        case SnugIntError::NegationOverflow:
+            snug::detail::Raise<SnugInt_Negation_Overflow_Exception>();
+        case SnugIntError::NegationUnderflow:
+            snug::detail::Raise<SnugInt_Negation_Underflow_Exception>();
+        case SnugIntError::InvalidFormat:
+            snug::detail::Raise<SnugInt_Invalid_Format_Exception>();
+        case SnugIntError::None:
+            break;
+    }
+    std::terminate();
+}
+
+// Layout guarantees, a SnugInt must be interchangeable with the raw integral it wraps
+#define SNUGINT_ASSERT_LAYOUT(T) \
+    static_assert(sizeof(SnugInt<T>) == sizeof(T), "SnugInt<" #T "> must be the size of " #T); \
+    static_assert(alignof(SnugInt<T>) == alignof(T), "SnugInt<" #T "> must be aligned like " #T); \
+    static_assert(std::is_trivially_copyable<SnugInt<T>>::value, "SnugInt<" #T "> must be trivially copyable"); \
+    static_assert(std::is_standard_layout<SnugInt<T>>::value, "SnugInt<" #T "> must be standard layout")
+
+SNUGINT_ASSERT_LAYOUT(char);
+SNUGINT_ASSERT_LAYOUT(signed char);
+SNUGINT_ASSERT_LAYOUT(unsigned char);
+SNUGINT_ASSERT_LAYOUT(short);
+SNUGINT_ASSERT_LAYOUT(unsigned short);
+SNUGINT_ASSERT_LAYOUT(int);
+SNUGINT_ASSERT_LAYOUT(unsigned int);
+SNUGINT_ASSERT_LAYOUT(long);
+SNUGINT_ASSERT_LAYOUT(unsigned long);
+SNUGINT_ASSERT_LAYOUT(long long);
+SNUGINT_ASSERT_LAYOUT(unsigned long long);
+#if SNUGINT_HAS_INT128
+SNUGINT_ASSERT_LAYOUT(__int128);
+SNUGINT_ASSERT_LAYOUT(unsigned __int128);
+#endif
+
+#undef SNUGINT_ASSERT_LAYOUT
@@ -0,0 +1,891 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGINT_BACKEND_H
+#define PROJECT_SNUGINT_BACKEND_H
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/**
+ * \brief Checked arithmetic backends
+ *
+ * \details
+ * The raw overflow checks used by SnugInt. Every operation computes the wrapped (two's complement)
+ * result into result and returns true when the real result does not fit in Type.
+ * All of them are constexpr, except the MSVC intrinsics before C++20.
+ *
+ * \details
+ * The Mixed checks take operands of any two integral types and check the exact result against a third,
+ * through __builtin_*_overflow when available, otherwise widened to 64 bits (or sign magnitude for
+ * 64 and 128 bit operands) with a single range check.
+ *
+ * \details
+ * The backend is selected at compile time, define SNUGINT_BACKEND to one of the values below to force one
+ * - SNUGINT_BACKEND_PORTABLE sign case precondition checks, works everywhere
+ * - SNUGINT_BACKEND_BUILTIN __builtin_*_overflow on GCC and Clang
+ * - SNUGINT_BACKEND_MSVC _addcarry/_subborrow/_mul128 intrinsics on MSVC x64
+ */
+#define SNUGINT_BACKEND_PORTABLE 0
+#define SNUGINT_BACKEND_BUILTIN 1
+#define SNUGINT_BACKEND_MSVC 2
+
+#ifndef SNUGINT_BACKEND
+#if defined(__GNUC__) || defined(__clang__)
+#define SNUGINT_BACKEND SNUGINT_BACKEND_BUILTIN
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define SNUGINT_BACKEND SNUGINT_BACKEND_MSVC
+#else
+#define SNUGINT_BACKEND SNUGINT_BACKEND_PORTABLE
+#endif
+#endif
+
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_MSVC
+#include <intrin.h>
+#endif
+
+/**
+ * \brief Checking modes
+ *
+ * \details
+ * SNUGINT_MODE decides what a SnugInt does with a failed check, the same source builds in every mode
+ * - SNUGINT_MODE_CHECKED the failure goes to the Policy (default)
+ * - SNUGINT_MODE_ASSUME  failures are assumed not to happen, the checks become optimizer hints
+ *   (a failure is undefined behavior, like overflowing the raw type)
+ * - SNUGINT_MODE_UNCHECKED the wrapped result is kept for every Policy, as with SnugIntWrapPolicy
+ *
+ * \details
+ * In the assume and unchecked modes every Policy is nothrow, so no operator has exception tables. Unchecked,
+ * a SnugInt compiles to the same code as its Type except for division, which keeps the zero divisor
+ * compare (snugint_codegen diffs the disassembly). The Try methods still report errors in every mode
+ */
+#define SNUGINT_MODE_CHECKED 0
+#define SNUGINT_MODE_ASSUME 1
+#define SNUGINT_MODE_UNCHECKED 2
+
+#ifndef SNUGINT_MODE
+#define SNUGINT_MODE SNUGINT_MODE_CHECKED
+#endif
+
+#if defined(__clang__)
+#define SNUGINT_ASSUME(condition) __builtin_assume(condition)
+#elif defined(__GNUC__)
+#define SNUGINT_ASSUME(condition) do { if (!(condition)) __builtin_unreachable(); } while (false)
+#elif defined(_MSC_VER)
+#define SNUGINT_ASSUME(condition) __assume(condition)
+#else
+#define SNUGINT_ASSUME(condition) static_cast<void>(0)
+#endif
+
+// Branch hints for the checks and the attribute of the out of line failure paths, which keeps them out of hot loops
+#if defined(__GNUC__) || defined(__clang__)
+#define SNUGINT_LIKELY(condition) __builtin_expect(!!(condition), 1)
+#define SNUGINT_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#define SNUGINT_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define SNUGINT_LIKELY(condition) (condition)
+#define SNUGINT_UNLIKELY(condition) (condition)
+#define SNUGINT_COLD __declspec(noinline)
+#else
+#define SNUGINT_LIKELY(condition) (condition)
+#define SNUGINT_UNLIKELY(condition) (condition)
+#define SNUGINT_COLD
+#endif
+
+// Vectorization of the batch kernels, GCC only runs its vectorizer from -O3 so the kernels ask for it
+#if defined(__clang__)
+#define SNUGINT_VECTORIZE
+#define SNUGINT_VECTORIZE_LOOP _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+#define SNUGINT_VECTORIZE __attribute__((optimize("tree-vectorize")))
+#define SNUGINT_VECTORIZE_LOOP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define SNUGINT_VECTORIZE
+#define SNUGINT_VECTORIZE_LOOP __pragma(loop(ivdep))
+#else
+#define SNUGINT_VECTORIZE
+#define SNUGINT_VECTORIZE_LOOP
+#endif
+
+// The MSVC intrinsics are not constexpr, constant expressions fall back to the portable checks when detectable
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define SNUGINT_HAS_CONSTANT_EVALUATED 1
+#define SNUGINT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(SNUGINT_HAS_CONSTANT_EVALUATED) && defined(__cpp_lib_is_constant_evaluated)
+#define SNUGINT_HAS_CONSTANT_EVALUATED 1
+#define SNUGINT_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#endif
+#ifndef SNUGINT_HAS_CONSTANT_EVALUATED
+#define SNUGINT_HAS_CONSTANT_EVALUATED 0
+#define SNUGINT_IS_CONSTANT_EVALUATED() false
+#endif
+
+// __int128 and unsigned __int128 are SnugInt types where the compiler has them, std::is_integral only takes them with GNU extensions
+#ifndef SNUGINT_HAS_INT128
+#if defined(__SIZEOF_INT128__)
+#define SNUGINT_HAS_INT128 1
+#else
+#define SNUGINT_HAS_INT128 0
+#endif
+#endif
+
+// Builds without exceptions (-fno-exceptions, /EHs-c-) abort where SnugInt would throw
+#ifndef SNUGINT_HAS_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define SNUGINT_HAS_EXCEPTIONS 1
+#else
+#define SNUGINT_HAS_EXCEPTIONS 0
+#endif
+#endif
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief std::is_integral, std::is_signed and std::make_unsigned that also take the 128 bit integers
+     */
+    template<class T> struct IsInteger : std::is_integral<T> {};
+    template<class T> struct IsSigned : std::is_signed<T> {};
+    template<class T> struct MakeUnsigned : std::make_unsigned<T> {};
+
+#if SNUGINT_HAS_INT128
+    template<> struct IsInteger<__int128> : std::true_type {};
+    template<> struct IsInteger<unsigned __int128> : std::true_type {};
+    template<> struct IsSigned<__int128> : std::true_type {};
+    template<> struct MakeUnsigned<__int128> { typedef unsigned __int128 type; };
+    template<> struct MakeUnsigned<unsigned __int128> { typedef unsigned __int128 type; };
+#endif
+
+    /**
+     * \brief Portable addition check (signed)
+     *
+     * \details
+     * Operation: + + + = + can only overflow and - + - = - can only underflow
+     */
+    template<class Type>
+    constexpr bool PortableAdd(Type left, Type right, Type *result, std::true_type)
+    {
+        typedef typename MakeUnsigned<Type>::type Unsigned;
+        *result = static_cast<Type>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right));
+
+        if (left > 0 && right > 0)
+        {   // Operation: + + + = +
+            return std::numeric_limits<Type>::max() - left < right;
+        } else if (left < 0 && right < 0)
+        {   // Operation: - + - = -
+            return std::numeric_limits<Type>::min() - left > right;
+        }
+        return false;
+    }
+
+    /**
+     * \brief Portable addition check (unsigned)
+     */
+    template<class Type>
+    constexpr bool PortableAdd(Type left, Type right, Type *result, std::false_type)
+    {
+        *result = static_cast<Type>(left + right);
+        return std::numeric_limits<Type>::max() - left < right;
+    }
+
+    /**
+     * \brief Portable subtraction check (signed)
+     *
+     * \details
+     * Operation: + - - = + can only overflow and - - + = - can only underflow
+     */
+    template<class Type>
+    constexpr bool PortableSub(Type left, Type right, Type *result, std::true_type)
+    {
+        typedef typename MakeUnsigned<Type>::type Unsigned;
+        *result = static_cast<Type>(static_cast<Unsigned>(left) - static_cast<Unsigned>(right));
+
+        if (left >= 0 && right < 0)
+        {   // Operation: + - - = +
+            return left > std::numeric_limits<Type>::max() + right;
+        } else if (left < 0 && right > 0)
+        {   // Operation: - - + = -
+            return left < std::numeric_limits<Type>::min() + right;
+        }
+        return false;
+    }
+
+    /**
+     * \brief Portable subtraction check (unsigned)
+     */
+    template<class Type>
+    constexpr bool PortableSub(Type left, Type right, Type *result, std::false_type)
+    {
+        *result = static_cast<Type>(left - right);
+        return left < right;
+    }
+
+    /**
+     * \brief Portable multiplication check (signed)
+     *
+     * \details
+     * Checks each of the four sign cases against the bound divided by one of the operands
+     */
+    template<class Type>
+    constexpr bool PortableMult(Type left, Type right, Type *result, std::true_type)
+    {
+        typedef typename MakeUnsigned<Type>::type Unsigned;
+        *result = static_cast<Type>(static_cast<Unsigned>(left) * static_cast<Unsigned>(right));
+
+        const Type max = std::numeric_limits<Type>::max();
+        const Type min = std::numeric_limits<Type>::min();
+
+        if (left > 0)
+        {
+            if (right > 0)
+            {   // Operands: + * + = +
+                return left > (max / right);
+            }
+            // Operands: + * - = -
+            return right < (min / left);
+        }
+
+        if (right > 0)
+        {   // Operands: - * + = -
+            return left < (min / right);
+        }
+        // Operands: - * - = +
+        return (left != 0) && (right < (max / left));
+    }
+
+    /**
+     * \brief Portable multiplication check (unsigned)
+     */
+    template<class Type>
+    constexpr bool PortableMult(Type left, Type right, Type *result, std::false_type)
+    {
+        typedef typename std::common_type<Type, unsigned int>::type Promoted;
+        *result = static_cast<Type>(static_cast<Promoted>(left) * right);
+        return (right != 0) && (left > std::numeric_limits<Type>::max() / right);
+    }
+
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_MSVC
+    /**
+     * \brief MSVC x64 intrinsic checks
+     *
+     * \details
+     * Unsigned 32/64 bit addition and subtraction use the carry flag through _addcarry/_subborrow,
+     * signed addition and subtraction use the wrapped result sign test (add + jo after optimization)
+     * and 64 bit multiplication reads the high half from _mul128/_umul128.
+     * Narrower multiplications are done exactly in 64 bits and range checked.
+     */
+    template<class Type>
+    struct MsvcSignedOps
+    {
+        typedef typename MakeUnsigned<Type>::type Unsigned;
+
+        static bool Add(Type left, Type right, Type *result)
+        {
+            *result = static_cast<Type>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right));
+            return ((left ^ *result) & (right ^ *result)) < 0;
+        }
+
+        static bool Sub(Type left, Type right, Type *result)
+        {
+            *result = static_cast<Type>(static_cast<Unsigned>(left) - static_cast<Unsigned>(right));
+            return ((left ^ right) & (left ^ *result)) < 0;
+        }
+    };
+
+    template<class Type, bool Signed = IsSigned<Type>::value, std::size_t Size = sizeof(Type)>
+    struct MsvcOps
+    {   // unsigned 8 and 16 bit, the promoted arithmetic is already exact
+        static bool Add(Type left, Type right, Type *result)
+        {
+            return PortableAdd(left, right, result, std::false_type());
+        }
+
+        static bool Sub(Type left, Type right, Type *result)
+        {
+            return PortableSub(left, right, result, std::false_type());
+        }
+
+        static bool Mult(Type left, Type right, Type *result)
+        {
+            unsigned long long wide = static_cast<unsigned long long>(left) * right;
+            *result = static_cast<Type>(wide);
+            return wide > std::numeric_limits<Type>::max();
+        }
+    };
+
+    template<class Type, std::size_t Size>
+    struct MsvcOps<Type, true, Size> : MsvcSignedOps<Type>
+    {
+        static bool Mult(Type left, Type right, Type *result)
+        {
+            long long wide = static_cast<long long>(left) * right;
+            *result = static_cast<Type>(wide);
+            return wide > std::numeric_limits<Type>::max() || wide < std::numeric_limits<Type>::min();
+        }
+    };
+
+    template<class Type>
+    struct MsvcOps<Type, true, 8> : MsvcSignedOps<Type>
+    {
+        static bool Mult(Type left, Type right, Type *result)
+        {
+            __int64 high;
+            __int64 low = _mul128(left, right, &high);
+            *result = static_cast<Type>(low);
+            return high != (low >> 63);
+        }
+    };
+
+    template<class Type>
+    struct MsvcOps<Type, false, 4> : MsvcOps<Type, false, 1>
+    {
+        static bool Add(Type left, Type right, Type *result)
+        {
+            unsigned int sum;
+            unsigned char carry = _addcarry_u32(0, left, right, &sum);
+            *result = static_cast<Type>(sum);
+            return carry != 0;
+        }
+
+        static bool Sub(Type left, Type right, Type *result)
+        {
+            unsigned int difference;
+            unsigned char borrow = _subborrow_u32(0, left, right, &difference);
+            *result = static_cast<Type>(difference);
+            return borrow != 0;
+        }
+    };
+
+    template<class Type>
+    struct MsvcOps<Type, false, 8>
+    {
+        static bool Add(Type left, Type right, Type *result)
+        {
+            unsigned __int64 sum;
+            unsigned char carry = _addcarry_u64(0, left, right, &sum);
+            *result = static_cast<Type>(sum);
+            return carry != 0;
+        }
+
+        static bool Sub(Type left, Type right, Type *result)
+        {
+            unsigned __int64 difference;
+            unsigned char borrow = _subborrow_u64(0, left, right, &difference);
+            *result = static_cast<Type>(difference);
+            return borrow != 0;
+        }
+
+        static bool Mult(Type left, Type right, Type *result)
+        {
+            unsigned __int64 high;
+            unsigned __int64 low = _umul128(left, right, &high);
+            *result = static_cast<Type>(low);
+            return high != 0;
+        }
+    };
+#endif
+
+    /**
+     * \brief Checked addition
+     *
+     * @tparam Type integral type of the operands
+     * @param left value to be added to right
+     * @param right value to be added to left
+     * @param result receives the wrapped sum
+     * @return true if the sum does not fit in Type
+     */
+    template<class Type>
+    constexpr bool AddOverflow(Type left, Type right, Type *result)
+    {
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_BUILTIN
+        return __builtin_add_overflow(left, right, result);
+#elif SNUGINT_BACKEND == SNUGINT_BACKEND_MSVC
+        if (SNUGINT_IS_CONSTANT_EVALUATED())
+            return PortableAdd(left, right, result, IsSigned<Type>());
+        return MsvcOps<Type>::Add(left, right, result);
+#else
+        return PortableAdd(left, right, result, IsSigned<Type>());
+#endif
+    }
+
+    /**
+     * \brief Checked subtraction
+     *
+     * @tparam Type integral type of the operands
+     * @param left value to be subtracted from
+     * @param right value to subtract
+     * @param result receives the wrapped difference
+     * @return true if the difference does not fit in Type
+     */
+    template<class Type>
+    constexpr bool SubOverflow(Type left, Type right, Type *result)
+    {
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_BUILTIN
+        return __builtin_sub_overflow(left, right, result);
+#elif SNUGINT_BACKEND == SNUGINT_BACKEND_MSVC
+        if (SNUGINT_IS_CONSTANT_EVALUATED())
+            return PortableSub(left, right, result, IsSigned<Type>());
+        return MsvcOps<Type>::Sub(left, right, result);
+#else
+        return PortableSub(left, right, result, IsSigned<Type>());
+#endif
+    }
+
+    /**
+     * \brief Checked multiplication
+     *
+     * @tparam Type integral type of the operands
+     * @param left value to be multiplied
+     * @param right value to be multiplied
+     * @param result receives the wrapped product
+     * @return true if the product does not fit in Type
+     */
+    template<class Type>
+    constexpr bool MultOverflow(Type left, Type right, Type *result)
+    {
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_BUILTIN
+        return __builtin_mul_overflow(left, right, result);
+#elif SNUGINT_BACKEND == SNUGINT_BACKEND_MSVC
+        if (SNUGINT_IS_CONSTANT_EVALUATED())
+            return PortableMult(left, right, result, IsSigned<Type>());
+        return MsvcOps<Type>::Mult(left, right, result);
+#else
+        return PortableMult(left, right, result, IsSigned<Type>());
+#endif
+    }
+
+    /**
+     * \brief true if item is below zero, always false for unsigned T
+     */
+    template<class T>
+    constexpr bool IsNegative(T item) noexcept
+    {
+        return IsSigned<T>::value && item < static_cast<T>(0);
+    }
+
+    /**
+     * \brief How a conversion from From to To is checked, decided at compile time
+     *
+     * \details
+     * - None: every From fits in To
+     *
+     * \details
+     * - Bound: one unsigned compare of item against the largest value that fits, a negative signed item
+     *   turns into a huge unsigned one and fails the same compare (any From to unsigned To, unsigned From
+     *   to a narrower signed To)
+     *
+     * \details
+     * - Offset: one unsigned compare of item - min against max - min (signed From to a narrower signed To)
+     */
+    enum class CastCheck
+    {
+        None,
+        Bound,
+        Offset
+    };
+
+    /**
+     * \brief Integrals every limit of Left and Right converts to without loss, 128 bit when either one is
+     */
+    template<class Left, class Right, bool Wide = (sizeof(Left) > 8 || sizeof(Right) > 8)>
+    struct LimitWord
+    {
+        typedef long long Signed;
+        typedef unsigned long long Unsigned;
+    };
+
+#if SNUGINT_HAS_INT128
+    template<class Left, class Right>
+    struct LimitWord<Left, Right, true>
+    {
+        typedef __int128 Signed;
+        typedef unsigned __int128 Unsigned;
+    };
+#endif
+
+    template<class To, class From>
+    constexpr CastCheck CastCheckOf() noexcept
+    {
+        typedef LimitWord<To, From> Word;
+        return (!IsSigned<From>::value || (IsSigned<To>::value &&
+                    static_cast<typename Word::Signed>(std::numeric_limits<From>::min()) >= static_cast<typename Word::Signed>(std::numeric_limits<To>::min())))
+               && static_cast<typename Word::Unsigned>(std::numeric_limits<From>::max()) <= static_cast<typename Word::Unsigned>(std::numeric_limits<To>::max())
+               ? CastCheck::None
+               : IsSigned<From>::value && IsSigned<To>::value ? CastCheck::Offset : CastCheck::Bound;
+    }
+
+    template<class To, class From>
+    constexpr bool CastFits(From, std::integral_constant<CastCheck, CastCheck::None>) noexcept
+    {
+        return true;
+    }
+
+    template<class To, class From>
+    constexpr bool CastFits(From item, std::integral_constant<CastCheck, CastCheck::Bound>) noexcept
+    {
+        typedef typename MakeUnsigned<From>::type Unsigned;
+        // the valid items of a signed From end at its own max
+        typedef typename LimitWord<To, From>::Unsigned Word;
+        const Word to = static_cast<Word>(std::numeric_limits<To>::max());
+        const Word from = static_cast<Word>(std::numeric_limits<From>::max());
+        return static_cast<Unsigned>(item) <= static_cast<Unsigned>(to < from ? to : from);
+    }
+
+    template<class To, class From>
+    constexpr bool CastFits(From item, std::integral_constant<CastCheck, CastCheck::Offset>) noexcept
+    {
+        typedef typename MakeUnsigned<From>::type Unsigned;
+        const Unsigned min = static_cast<Unsigned>(std::numeric_limits<To>::min());
+        const Unsigned max = static_cast<Unsigned>(std::numeric_limits<To>::max());
+        return static_cast<Unsigned>(static_cast<Unsigned>(item) - min) <= static_cast<Unsigned>(max - min);
+    }
+
+    /**
+     * \brief Range check of an integral of any type against To
+     *
+     * \details
+     * Picks the check of CastCheckOf at compile time, there is no signed / unsigned mismatch and
+     * every check is at most one unsigned compare
+     *
+     * @tparam To integral type item should fit in
+     * @tparam From integral type of item
+     * @param item value to check
+     * @return true if item is representable in To
+     */
+    template<class To, class From>
+    constexpr bool Fits(From item) noexcept
+    {
+        return CastFits<To>(item, std::integral_constant<CastCheck, CastCheckOf<To, From>()>());
+    }
+
+    /**
+     * \brief Sign magnitude value of up to 65 bits, exact for every mixed 64 bit sum, difference and quotient
+     *
+     * \details
+     * Used where no wider type is available, a product that does not fit sets wide and keeps the low 64 bits
+     * of the magnitude so the wrapped result is still the two's complement one. With a 128 bit operand the
+     * magnitude is an unsigned __int128, see ExactMagnitude
+     */
+    template<class Magnitude>
+    struct BasicExact
+    {
+        Magnitude magnitude; /**< low bits of the magnitude */
+        bool negative;       /**< sign, never set for zero */
+        bool wide;           /**< magnitude does not fit in Magnitude */
+    };
+
+    typedef BasicExact<unsigned long long> Exact;
+
+    /**
+     * \brief Magnitude type that holds every value of Left and Right, and of Result if the result is checked against it
+     */
+    template<class Left, class Right = Left, class Result = Left>
+    struct ExactMagnitude
+    {
+#if SNUGINT_HAS_INT128
+        typedef typename std::conditional<(sizeof(Left) > 8 || sizeof(Right) > 8 || sizeof(Result) > 8),
+                                          unsigned __int128, unsigned long long>::type type;
+#else
+        typedef unsigned long long type;
+#endif
+    };
+
+    template<class T, class Magnitude = typename ExactMagnitude<T>::type>
+    constexpr BasicExact<Magnitude> ExactOf(T item) noexcept
+    {
+        BasicExact<Magnitude> exact = {static_cast<Magnitude>(item), IsNegative(item), false};
+        if (exact.negative)
+            exact.magnitude = static_cast<Magnitude>(0) - exact.magnitude;
+        return exact;
+    }
+
+    template<class Magnitude>
+    constexpr BasicExact<Magnitude> ExactAdd(BasicExact<Magnitude> left, BasicExact<Magnitude> right) noexcept
+    {
+        BasicExact<Magnitude> exact = {0, left.negative, false};
+        if (left.negative == right.negative)
+        {   // same sign, the magnitudes add up
+            exact.magnitude = left.magnitude + right.magnitude;
+            exact.wide = exact.magnitude < left.magnitude;
+        } else if (left.magnitude >= right.magnitude)
+        {
+            exact.magnitude = left.magnitude - right.magnitude;
+        } else
+        {
+            exact.magnitude = right.magnitude - left.magnitude;
+            exact.negative = right.negative;
+        }
+        exact.negative = exact.negative && (exact.magnitude != 0 || exact.wide);
+        return exact;
+    }
+
+    template<class Magnitude>
+    constexpr BasicExact<Magnitude> ExactNegate(BasicExact<Magnitude> item) noexcept
+    {
+        item.negative = !item.negative && item.magnitude != 0;
+        return item;
+    }
+
+    template<class Magnitude>
+    constexpr BasicExact<Magnitude> ExactMult(BasicExact<Magnitude> left, BasicExact<Magnitude> right) noexcept
+    {
+        BasicExact<Magnitude> exact = {left.magnitude * right.magnitude, false, false};
+        exact.negative = left.negative != right.negative && left.magnitude != 0 && right.magnitude != 0;
+        exact.wide = left.magnitude != 0 && right.magnitude > std::numeric_limits<Magnitude>::max() / left.magnitude;
+        return exact;
+    }
+
+    /**
+     * \brief Quotient rounded towards zero, right must not be zero
+     */
+    template<class Magnitude>
+    constexpr BasicExact<Magnitude> ExactDiv(BasicExact<Magnitude> left, BasicExact<Magnitude> right) noexcept
+    {
+        BasicExact<Magnitude> exact = {left.magnitude / right.magnitude, false, false};
+        exact.negative = left.negative != right.negative && exact.magnitude != 0;
+        return exact;
+    }
+
+    /**
+     * \brief Remainder with the sign of left, right must not be zero
+     */
+    template<class Magnitude>
+    constexpr BasicExact<Magnitude> ExactMod(BasicExact<Magnitude> left, BasicExact<Magnitude> right) noexcept
+    {
+        BasicExact<Magnitude> exact = {left.magnitude % right.magnitude, false, false};
+        exact.negative = left.negative && exact.magnitude != 0;
+        return exact;
+    }
+
+    template<class To, class Magnitude>
+    constexpr bool ExactFits(BasicExact<Magnitude> item) noexcept
+    {
+        const Magnitude max = static_cast<Magnitude>(std::numeric_limits<To>::max());
+        if (item.wide)
+            return false;
+        if (item.negative)
+            return IsSigned<To>::value && item.magnitude - 1 <= max;
+        return item.magnitude <= max;
+    }
+
+    template<class To, class Magnitude>
+    constexpr To ExactWrap(BasicExact<Magnitude> item) noexcept
+    {
+        return static_cast<To>(item.negative ? static_cast<Magnitude>(0) - item.magnitude : item.magnitude);
+    }
+
+    /**
+     * \brief true if both operands are narrower than 64 bits
+     *
+     * \details
+     * Then every sum, difference and quotient is exact in long long, and every product is exact in
+     * long long (or unsigned long long when both operands are unsigned)
+     */
+    template<class Left, class Right>
+    struct MixedNarrow : std::integral_constant<bool, (sizeof(Left) < 8 && sizeof(Right) < 8)> {};
+
+    template<class Left, class Right>
+    struct MixedProduct
+    {
+        typedef typename std::conditional<IsSigned<Left>::value || IsSigned<Right>::value,
+                                          long long, unsigned long long>::type type;
+    };
+
+    /**
+     * \brief Portable mixed checks, widened to 64 bits with a single range check
+     */
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedAdd(Left left, Right right, Result *result, std::true_type)
+    {
+        const long long wide = static_cast<long long>(left) + static_cast<long long>(right);
+        *result = static_cast<Result>(wide);
+        return !Fits<Result>(wide);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedSub(Left left, Right right, Result *result, std::true_type)
+    {
+        const long long wide = static_cast<long long>(left) - static_cast<long long>(right);
+        *result = static_cast<Result>(wide);
+        return !Fits<Result>(wide);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedMult(Left left, Right right, Result *result, std::true_type)
+    {
+        typedef typename MixedProduct<Left, Right>::type Wide;
+        const Wide wide = static_cast<Wide>(left) * static_cast<Wide>(right);
+        *result = static_cast<Result>(wide);
+        return !Fits<Result>(wide);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedDiv(Left left, Right right, Result *result, std::true_type)
+    {
+        const long long wide = static_cast<long long>(left) / static_cast<long long>(right);
+        *result = static_cast<Result>(wide);
+        return !Fits<Result>(wide);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedMod(Left left, Right right, Result *result, std::true_type)
+    {
+        const long long wide = static_cast<long long>(left) % static_cast<long long>(right);
+        *result = static_cast<Result>(wide);
+        return !Fits<Result>(wide);
+    }
+
+    /**
+     * \brief Portable mixed checks with a 64 or 128 bit operand, done in sign magnitude
+     */
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedAdd(Left left, Right right, Result *result, std::false_type)
+    {
+        typedef typename ExactMagnitude<Left, Right, Result>::type Magnitude;
+        const BasicExact<Magnitude> exact = ExactAdd(ExactOf<Left, Magnitude>(left), ExactOf<Right, Magnitude>(right));
+        *result = ExactWrap<Result>(exact);
+        return !ExactFits<Result>(exact);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedSub(Left left, Right right, Result *result, std::false_type)
+    {
+        typedef typename ExactMagnitude<Left, Right, Result>::type Magnitude;
+        const BasicExact<Magnitude> exact = ExactAdd(ExactOf<Left, Magnitude>(left), ExactNegate(ExactOf<Right, Magnitude>(right)));
+        *result = ExactWrap<Result>(exact);
+        return !ExactFits<Result>(exact);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedMult(Left left, Right right, Result *result, std::false_type)
+    {
+        typedef typename ExactMagnitude<Left, Right, Result>::type Magnitude;
+        const BasicExact<Magnitude> exact = ExactMult(ExactOf<Left, Magnitude>(left), ExactOf<Right, Magnitude>(right));
+        *result = ExactWrap<Result>(exact);
+        return !ExactFits<Result>(exact);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedDiv(Left left, Right right, Result *result, std::false_type)
+    {
+        typedef typename ExactMagnitude<Left, Right, Result>::type Magnitude;
+        const BasicExact<Magnitude> exact = ExactDiv(ExactOf<Left, Magnitude>(left), ExactOf<Right, Magnitude>(right));
+        *result = ExactWrap<Result>(exact);
+        return !ExactFits<Result>(exact);
+    }
+
+    template<class Result, class Left, class Right>
+    constexpr bool PortableMixedMod(Left left, Right right, Result *result, std::false_type)
+    {
+        typedef typename ExactMagnitude<Left, Right, Result>::type Magnitude;
+        const BasicExact<Magnitude> exact = ExactMod(ExactOf<Left, Magnitude>(left), ExactOf<Right, Magnitude>(right));
+        *result = ExactWrap<Result>(exact);
+        return !ExactFits<Result>(exact);
+    }
+
+    /**
+     * \brief Checked addition of operands of any integral types
+     *
+     * @tparam Result integral type the sum has to fit in
+     * @tparam Left integral type of left
+     * @tparam Right integral type of right
+     * @param left value to be added to right
+     * @param right value to be added to left
+     * @param result receives the wrapped sum
+     * @return true if the exact sum does not fit in Result
+     */
+    template<class Result, class Left, class Right>
+    constexpr bool MixedAddOverflow(Left left, Right right, Result *result)
+    {
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_BUILTIN
+        return __builtin_add_overflow(left, right, result);
+#else
+        return PortableMixedAdd(left, right, result, MixedNarrow<Left, Right>());
+#endif
+    }
+
+    /**
+     * \brief Checked subtraction of operands of any integral types
+     *
+     * @return true if the exact difference does not fit in Result
+     */
+    template<class Result, class Left, class Right>
+    constexpr bool MixedSubOverflow(Left left, Right right, Result *result)
+    {
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_BUILTIN
+        return __builtin_sub_overflow(left, right, result);
+#else
+        return PortableMixedSub(left, right, result, MixedNarrow<Left, Right>());
+#endif
+    }
+
+    /**
+     * \brief Checked multiplication of operands of any integral types
+     *
+     * @return true if the exact product does not fit in Result
+     */
+    template<class Result, class Left, class Right>
+    constexpr bool MixedMultOverflow(Left left, Right right, Result *result)
+    {
+#if SNUGINT_BACKEND == SNUGINT_BACKEND_BUILTIN
+        return __builtin_mul_overflow(left, right, result);
+#else
+        return PortableMixedMult(left, right, result, MixedNarrow<Left, Right>());
+#endif
+    }
+
+    /**
+     * \brief Checked division of operands of any integral types, right must not be zero
+     *
+     * @return true if the exact quotient does not fit in Result
+     */
+    template<class Result, class Left, class Right>
+    constexpr bool MixedDivOverflow(Left left, Right right, Result *result)
+    {
+        return PortableMixedDiv(left, right, result, MixedNarrow<Left, Right>());
+    }
+
+    /**
+     * \brief Checked remainder of operands of any integral types, right must not be zero
+     *
+     * \details
+     * The remainder has the sign of left and is smaller than right, min % -1 is 0 without the
+     * division that would overflow
+     *
+     * @return true if the exact remainder does not fit in Result
+     */
+    template<class Result, class Left, class Right>
+    constexpr bool MixedModOverflow(Left left, Right right, Result *result)
+    {
+        return PortableMixedMod(left, right, result, MixedNarrow<Left, Right>());
+    }
+
+    /**
+     * \brief Enables the mixed SnugInt overloads, Left and Right must be integrals that are not both Type
+     */
+    template<class Type, class Left, class Right, class Result>
+    using EnableMixed = typename std::enable_if<IsInteger<Left>::value && IsInteger<Right>::value &&
+                                                !(std::is_same<Left, Type>::value && std::is_same<Right, Type>::value),
+                                                Result>::type;
+}
+}
+
+#endif //PROJECT_SNUGINT_BACKEND_H
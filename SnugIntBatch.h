@@ -0,0 +1,108 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGINT_BATCH_H
+#define PROJECT_SNUGINT_BATCH_H
+
+#include <cstddef>
+
+#include "SnugInt.h"
+
+/**
+ * \brief Checked batch operations over arrays
+ *
+ * \details
+ * Element wise add, sub and mul over raw integer arrays or SnugInt arrays. The kernels compute every
+ * result and accumulate an overflow mask per block with branch free checks, so the compiler can
+ * vectorize them for the enabled instruction set (SSE4, AVX2, AVX-512, NEON). Only a block whose
+ * mask is set is scanned again to find the first failing index.
+ *
+ * \details
+ * - The raw overloads never throw, every element of out is written (wrapped on failure)
+ *   and the first failing element is reported in the returned BatchResult
+ *
+ * \details
+ * - The SnugInt overloads additionally hand each failing element to the SnugInt Policy,
+ *   so a SnugIntThrowPolicy array throws at the first failing element
+ *
+ * \details
+ * - out may be the same array as an input but must not partially overlap it, cast needs distinct arrays
+ *
+ * \details
+ * - cast narrows every element with the compile time check of snug_cast, a failing element is
+ *   SizeMismatch, truncated in the raw overload and handed to the Policy (saturating to the bound on
+ *   its side) in the SnugInt ones
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *snug::BatchResult result = snug::add(prices, fees, totals, count);
+ *if (!result.ok())
+ *{
+ *    // totals[result.index] overflowed with result.error
+ *}
+ * \endcode
+ */
+namespace snug
+{
+    /**
+     * \brief Result of a batch operation
+     */
+    struct BatchResult
+    {
+        SnugIntError error; /**< error of the first failing element, SnugIntError::None on success */
+        std::size_t index;  /**< index of the first failing element, the element count on success */
+
+        constexpr bool ok() const noexcept { return error == SnugIntError::None; };
+        constexpr explicit operator bool() const noexcept { return ok(); };
+    };
+
+    // Element wise (array, array)
+    template<class T> BatchResult add(const T* left, const T* right, T* out, std::size_t count) noexcept;
+    template<class T> BatchResult sub(const T* left, const T* right, T* out, std::size_t count) noexcept;
+    template<class T> BatchResult mul(const T* left, const T* right, T* out, std::size_t count) noexcept;
+
+    // Scalar broadcast (array, scalar)
+    template<class T> BatchResult add(const T* left, T right, T* out, std::size_t count) noexcept;
+    template<class T> BatchResult sub(const T* left, T right, T* out, std::size_t count) noexcept;
+    template<class T> BatchResult mul(const T* left, T right, T* out, std::size_t count) noexcept;
+
+    // SnugInt arrays (array, array)
+    template<class T, class P> BatchResult add(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                                               SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow);
+    template<class T, class P> BatchResult sub(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                                               SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow);
+    template<class T, class P> BatchResult mul(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                                               SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow);
+
+    // SnugInt arrays (array, scalar)
+    template<class T, class P> BatchResult add(const SnugInt<T, P>* left, SnugInt<T, P> right,
+                                               SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow);
+    template<class T, class P> BatchResult sub(const SnugInt<T, P>* left, SnugInt<T, P> right,
+                                               SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow);
+    template<class T, class P> BatchResult mul(const SnugInt<T, P>* left, SnugInt<T, P> right,
+                                               SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow);
+
+    // Checked conversion (array) of integrals or SnugInts, like snug_cast
+    template<class To, class From> BatchResult cast(const From* in, To* out, std::size_t count) noexcept;
+    template<class T, class P, class From> BatchResult cast(const From* in, SnugInt<T, P>* out,
+                                                            std::size_t count) noexcept(P::nothrow);
+    template<class T, class P, class F, class Q> BatchResult cast(const SnugInt<F, Q>* in, SnugInt<T, P>* out,
+                                                                  std::size_t count) noexcept(P::nothrow);
+}
+
+#include "SnugIntBatch.tpp"
+
+#endif //PROJECT_SNUGINT_BATCH_H
@@ -0,0 +1,636 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include "SnugIntBatch.h"
+
+#include <cstring>
+
+namespace snug
+{
+namespace detail
+{
+    /** elements per block, one block of results is staged on the stack */
+    constexpr std::size_t BatchBlock = 512;
+
+    /**
+     * \brief Operand reading element i of an array
+     */
+    template<class T>
+    struct ArrayOperand
+    {
+        const T* data;
+        T operator[](std::size_t i) const { return data[i]; };
+    };
+
+    /**
+     * \brief Operand broadcasting a single value
+     */
+    template<class T>
+    struct ScalarOperand
+    {
+        T value;
+        T operator[](std::size_t) const { return value; };
+    };
+
+    /**
+     * \brief Branch free addition kernel
+     *
+     * \details
+     * Apply returns the wrapped sum and folds the overflow into mask, for signed types the sign bit
+     * of (left ^ sum) & (right ^ sum) is set on overflow, for unsigned types the sum wraps below left
+     */
+    template<class T, bool Signed = IsSigned<T>::value>
+    struct BatchAdd
+    {
+        typedef typename MakeUnsigned<T>::type Unsigned;
+
+        static T Apply(T left, T right, T& mask)
+        {
+            T sum = static_cast<T>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right));
+            mask |= static_cast<T>((left ^ sum) & (right ^ sum));
+            return sum;
+        }
+
+        static bool Failed(T mask) { return mask < 0; };
+        static SnugIntResult<T> Try(T left, T right) { return SnugInt<T, SnugIntWrapPolicy>::TryAdd(left, right); };
+    };
+
+    template<class T>
+    struct BatchAdd<T, false>
+    {
+        static T Apply(T left, T right, T& mask)
+        {
+            T sum = static_cast<T>(left + right);
+            mask |= static_cast<T>(sum < left);
+            return sum;
+        }
+
+        static bool Failed(T mask) { return mask != 0; };
+        static SnugIntResult<T> Try(T left, T right) { return SnugInt<T, SnugIntWrapPolicy>::TryAdd(left, right); };
+    };
+
+    /**
+     * \brief Branch free subtraction kernel
+     *
+     * \details
+     * For signed types the sign bit of (left ^ right) & (left ^ difference) is set on overflow,
+     * for unsigned types the subtraction underflows when right is larger than left
+     */
+    template<class T, bool Signed = IsSigned<T>::value>
+    struct BatchSub
+    {
+        typedef typename MakeUnsigned<T>::type Unsigned;
+
+        static T Apply(T left, T right, T& mask)
+        {
+            T difference = static_cast<T>(static_cast<Unsigned>(left) - static_cast<Unsigned>(right));
+            mask |= static_cast<T>((left ^ right) & (left ^ difference));
+            return difference;
+        }
+
+        static bool Failed(T mask) { return mask < 0; };
+        static SnugIntResult<T> Try(T left, T right) { return SnugInt<T, SnugIntWrapPolicy>::TrySub(left, right); };
+    };
+
+    template<class T>
+    struct BatchSub<T, false>
+    {
+        static T Apply(T left, T right, T& mask)
+        {
+            mask |= static_cast<T>(left < right);
+            return static_cast<T>(left - right);
+        }
+
+        static bool Failed(T mask) { return mask != 0; };
+        static SnugIntResult<T> Try(T left, T right) { return SnugInt<T, SnugIntWrapPolicy>::TrySub(left, right); };
+    };
+
+    /**
+     * \brief Branch free multiplication kernel
+     *
+     * \details
+     * Types up to 32 bits multiply exactly in twice their width and fail when the product does not
+     * survive narrowing, 64 and 128 bit types use the checked arithmetic backend per element
+     */
+    template<class T, bool Backend = (sizeof(T) >= 8)>
+    struct BatchMul
+    {
+        typedef typename std::conditional<(sizeof(T) <= 2),
+                typename std::conditional<IsSigned<T>::value, int, unsigned int>::type,
+                typename std::conditional<IsSigned<T>::value, long long, unsigned long long>::type>::type Wide;
+
+        static T Apply(T left, T right, T& mask)
+        {
+            Wide product = static_cast<Wide>(left) * static_cast<Wide>(right);
+            T narrow = static_cast<T>(product);
+            mask |= static_cast<T>(product != static_cast<Wide>(narrow));
+            return narrow;
+        }
+
+        static bool Failed(T mask) { return mask != 0; };
+        static SnugIntResult<T> Try(T left, T right) { return SnugInt<T, SnugIntWrapPolicy>::TryMult(left, right); };
+    };
+
+    template<class T>
+    struct BatchMul<T, true>
+    {
+        static T Apply(T left, T right, T& mask)
+        {
+            T product = 0;
+            mask |= static_cast<T>(MultOverflow(left, right, &product));
+            return product;
+        }
+
+        static bool Failed(T mask) { return mask != 0; };
+        static SnugIntResult<T> Try(T left, T right) { return SnugInt<T, SnugIntWrapPolicy>::TryMult(left, right); };
+    };
+
+    /**
+     * \brief Keeps the wrapped value of a failed element, used by the raw overloads
+     */
+    template<class T>
+    struct BatchWrap
+    {
+        T operator()(const SnugIntResult<T>& result) const noexcept { return result.value; };
+    };
+
+    /**
+     * \brief Hands a failed element to the SnugInt Policy, used by the SnugInt overloads
+     */
+    template<class T, class P>
+    struct BatchResolve
+    {
+        T operator()(const SnugIntResult<T>& result) const noexcept(P::nothrow)
+        {
+            return SnugInt<T, P>::Resolve(result);
+        };
+    };
+
+    /**
+     * \brief Runs a batch kernel over count elements
+     *
+     * \details
+     * Each block is computed into a stack buffer while the overflow mask is accumulated, so the inputs
+     * are still intact when a block has to be scanned for its failing elements, then the block is
+     * copied to out. This keeps in place operation (out == left) correct.
+     *
+     * @tparam Op kernel, one of BatchAdd, BatchSub, BatchMul
+     * @tparam T integral type of the elements
+     * @tparam Left operand type for left
+     * @tparam Right operand type for right
+     * @tparam Handler decides the stored value of a failed element
+     * @param left left operand
+     * @param right right operand
+     * @param out array receiving count results
+     * @param count number of elements
+     * @param handler called for every failed element
+     * @return the first failing element, or the element count on success
+     */
+    template<class Op, class T, class Left, class Right, class Handler>
+    SNUGINT_VECTORIZE BatchResult BatchApply(Left left, Right right, T* out, std::size_t count, Handler handler)
+        noexcept(noexcept(handler(SnugIntResult<T>())))
+    {
+        BatchResult result = {SnugIntError::None, count};
+        T block[BatchBlock];
+
+        for (std::size_t start = 0; start < count; start += BatchBlock)
+        {
+            const std::size_t size = count - start < BatchBlock ? count - start : BatchBlock;
+            T mask = 0;
+
+            SNUGINT_VECTORIZE_LOOP
+            for (std::size_t i = 0; i < size; ++i)
+                block[i] = Op::Apply(left[start + i], right[start + i], mask);
+
+            if (Op::Failed(mask))
+            {   // rare, find the failing elements of this block
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    SnugIntResult<T> element = Op::Try(left[start + i], right[start + i]);
+                    if (element.ok())
+                        continue;
+
+                    if (result.ok())
+                    {
+                        result.error = element.error;
+                        result.index = start + i;
+                    }
+                    block[i] = handler(element);
+                }
+            }
+
+            std::memcpy(out + start, block, size * sizeof(T));
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Keeps the truncated value of a failed conversion, used by the raw cast
+     */
+    template<class To>
+    struct CastWrap
+    {
+        To operator()(const SnugIntResult<To>& result, To) const noexcept { return result.value; };
+    };
+
+    /**
+     * \brief Hands a failed conversion to the SnugInt Policy with the bound on the side of the item
+     */
+    template<class To, class P>
+    struct CastResolve
+    {
+        To operator()(const SnugIntResult<To>& result, To saturated) const noexcept(P::nothrow)
+        {
+            return SnugInt<To, P>::Resolve(result, saturated);
+        };
+    };
+
+    /**
+     * \brief Runs a checked conversion over count elements
+     *
+     * \details
+     * Every element is converted while the failed checks are or'ed together per block, the check is
+     * the single compare (or nothing) of snug::detail::CastCheck so the loop vectorizes. Only a block
+     * with a failure is scanned again
+     *
+     * @tparam To integral type of out
+     * @tparam From integral type of in
+     * @tparam Handler decides the stored value of a failed element
+     * @param in array of count items
+     * @param out array receiving count converted items, distinct from in
+     * @param count number of elements
+     * @param handler called for every failed element
+     * @return the first failing element, or the element count on success
+     */
+    template<class To, class From, class Handler>
+    SNUGINT_VECTORIZE BatchResult CastApply(const From* in, To* out, std::size_t count, Handler handler)
+        noexcept(noexcept(handler(SnugIntResult<To>(), To())))
+    {
+        static_assert(IsInteger<From>::value && IsInteger<To>::value, "snug::cast converts integrals and SnugInts only");
+        BatchResult result = {SnugIntError::None, count};
+
+        for (std::size_t start = 0; start < count; start += BatchBlock)
+        {
+            const std::size_t size = count - start < BatchBlock ? count - start : BatchBlock;
+            From mask = 0;
+
+            SNUGINT_VECTORIZE_LOOP
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                out[start + i] = static_cast<To>(in[start + i]);
+                mask |= static_cast<From>(!Fits<To>(in[start + i]));
+            }
+
+            if (mask != 0)
+            {   // rare, find the failing elements of this block
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    const From item = in[start + i];
+                    if (Fits<To>(item))
+                        continue;
+
+                    if (result.ok())
+                    {
+                        result.error = SnugIntError::SizeMismatch;
+                        result.index = start + i;
+                    }
+                    const SnugIntResult<To> element = {static_cast<To>(item), SnugIntError::SizeMismatch};
+                    out[start + i] = handler(element, IsNegative(item) ? std::numeric_limits<To>::min()
+                                                                       : std::numeric_limits<To>::max());
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Views a SnugInt array as the raw integral array it is layed out as
+     */
+    template<class T, class P>
+    const T* RawArray(const SnugInt<T, P>* data) noexcept
+    {
+        return reinterpret_cast<const T*>(data);
+    }
+
+    template<class T, class P>
+    T* RawArray(SnugInt<T, P>* data) noexcept
+    {
+        return reinterpret_cast<T*>(data);
+    }
+}
+
+    /**
+     * \brief Checked element wise addition
+     *
+     * @tparam T integral type of the elements
+     * @param left array to be added to right
+     * @param right array to be added to left
+     * @param out array receiving count sums
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T>
+    BatchResult add(const T* left, const T* right, T* out, std::size_t count) noexcept
+    {
+        detail::ArrayOperand<T> l = {left};
+        detail::ArrayOperand<T> r = {right};
+        return detail::BatchApply<detail::BatchAdd<T>>(l, r, out, count, detail::BatchWrap<T>());
+    }
+
+    /**
+     * \brief Checked element wise subtraction
+     *
+     * @tparam T integral type of the elements
+     * @param left array to be subtracted from
+     * @param right array to subtract
+     * @param out array receiving count differences
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T>
+    BatchResult sub(const T* left, const T* right, T* out, std::size_t count) noexcept
+    {
+        detail::ArrayOperand<T> l = {left};
+        detail::ArrayOperand<T> r = {right};
+        return detail::BatchApply<detail::BatchSub<T>>(l, r, out, count, detail::BatchWrap<T>());
+    }
+
+    /**
+     * \brief Checked element wise multiplication
+     *
+     * @tparam T integral type of the elements
+     * @param left array to be multiplied
+     * @param right array to be multiplied
+     * @param out array receiving count products
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T>
+    BatchResult mul(const T* left, const T* right, T* out, std::size_t count) noexcept
+    {
+        detail::ArrayOperand<T> l = {left};
+        detail::ArrayOperand<T> r = {right};
+        return detail::BatchApply<detail::BatchMul<T>>(l, r, out, count, detail::BatchWrap<T>());
+    }
+
+    /**
+     * \brief Checked addition of a scalar to every element
+     *
+     * @tparam T integral type of the elements
+     * @param left array to be added to right
+     * @param right value added to every element
+     * @param out array receiving count sums
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T>
+    BatchResult add(const T* left, T right, T* out, std::size_t count) noexcept
+    {
+        detail::ArrayOperand<T> l = {left};
+        detail::ScalarOperand<T> r = {right};
+        return detail::BatchApply<detail::BatchAdd<T>>(l, r, out, count, detail::BatchWrap<T>());
+    }
+
+    /**
+     * \brief Checked subtraction of a scalar from every element
+     *
+     * @tparam T integral type of the elements
+     * @param left array to be subtracted from
+     * @param right value subtracted from every element
+     * @param out array receiving count differences
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T>
+    BatchResult sub(const T* left, T right, T* out, std::size_t count) noexcept
+    {
+        detail::ArrayOperand<T> l = {left};
+        detail::ScalarOperand<T> r = {right};
+        return detail::BatchApply<detail::BatchSub<T>>(l, r, out, count, detail::BatchWrap<T>());
+    }
+
+    /**
+     * \brief Checked multiplication of every element by a scalar
+     *
+     * @tparam T integral type of the elements
+     * @param left array to be multiplied
+     * @param right value every element is multiplied by
+     * @param out array receiving count products
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T>
+    BatchResult mul(const T* left, T right, T* out, std::size_t count) noexcept
+    {
+        detail::ArrayOperand<T> l = {left};
+        detail::ScalarOperand<T> r = {right};
+        return detail::BatchApply<detail::BatchMul<T>>(l, r, out, count, detail::BatchWrap<T>());
+    }
+
+    /**
+     * \brief Checked element wise addition of SnugInt arrays
+     *
+     * \details
+     * Failing elements are handed to the Policy P
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @param left array to be added to right
+     * @param right array to be added to left
+     * @param out array receiving count sums
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class P>
+    BatchResult add(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                    SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        detail::ArrayOperand<T> l = {detail::RawArray(left)};
+        detail::ArrayOperand<T> r = {detail::RawArray(right)};
+        return detail::BatchApply<detail::BatchAdd<T>>(l, r, detail::RawArray(out), count,
+                                                       detail::BatchResolve<T, P>());
+    }
+
+    /**
+     * \brief Checked element wise subtraction of SnugInt arrays
+     *
+     * \details
+     * Failing elements are handed to the Policy P
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @param left array to be subtracted from
+     * @param right array to subtract
+     * @param out array receiving count differences
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class P>
+    BatchResult sub(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                    SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        detail::ArrayOperand<T> l = {detail::RawArray(left)};
+        detail::ArrayOperand<T> r = {detail::RawArray(right)};
+        return detail::BatchApply<detail::BatchSub<T>>(l, r, detail::RawArray(out), count,
+                                                       detail::BatchResolve<T, P>());
+    }
+
+    /**
+     * \brief Checked element wise multiplication of SnugInt arrays
+     *
+     * \details
+     * Failing elements are handed to the Policy P
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @param left array to be multiplied
+     * @param right array to be multiplied
+     * @param out array receiving count products
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class P>
+    BatchResult mul(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                    SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        detail::ArrayOperand<T> l = {detail::RawArray(left)};
+        detail::ArrayOperand<T> r = {detail::RawArray(right)};
+        return detail::BatchApply<detail::BatchMul<T>>(l, r, detail::RawArray(out), count,
+                                                       detail::BatchResolve<T, P>());
+    }
+
+    /**
+     * \brief Checked addition of a SnugInt to every element of a SnugInt array
+     *
+     * \details
+     * Failing elements are handed to the Policy P
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @param left array to be added to right
+     * @param right value added to every element
+     * @param out array receiving count sums
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class P>
+    BatchResult add(const SnugInt<T, P>* left, SnugInt<T, P> right,
+                    SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        detail::ArrayOperand<T> l = {detail::RawArray(left)};
+        detail::ScalarOperand<T> r = {right.getValue()};
+        return detail::BatchApply<detail::BatchAdd<T>>(l, r, detail::RawArray(out), count,
+                                                       detail::BatchResolve<T, P>());
+    }
+
+    /**
+     * \brief Checked subtraction of a SnugInt from every element of a SnugInt array
+     *
+     * \details
+     * Failing elements are handed to the Policy P
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @param left array to be subtracted from
+     * @param right value subtracted from every element
+     * @param out array receiving count differences
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class P>
+    BatchResult sub(const SnugInt<T, P>* left, SnugInt<T, P> right,
+                    SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        detail::ArrayOperand<T> l = {detail::RawArray(left)};
+        detail::ScalarOperand<T> r = {right.getValue()};
+        return detail::BatchApply<detail::BatchSub<T>>(l, r, detail::RawArray(out), count,
+                                                       detail::BatchResolve<T, P>());
+    }
+
+    /**
+     * \brief Checked multiplication of every element of a SnugInt array by a SnugInt
+     *
+     * \details
+     * Failing elements are handed to the Policy P
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @param left array to be multiplied
+     * @param right value every element is multiplied by
+     * @param out array receiving count products
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class P>
+    BatchResult mul(const SnugInt<T, P>* left, SnugInt<T, P> right,
+                    SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        detail::ArrayOperand<T> l = {detail::RawArray(left)};
+        detail::ScalarOperand<T> r = {right.getValue()};
+        return detail::BatchApply<detail::BatchMul<T>>(l, r, detail::RawArray(out), count,
+                                                       detail::BatchResolve<T, P>());
+    }
+
+    /**
+     * \brief Checked element wise conversion
+     *
+     * @tparam To integral type of out
+     * @tparam From integral type of in
+     * @param in array of count items
+     * @param out array receiving count converted items, truncated where they do not fit
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class To, class From>
+    BatchResult cast(const From* in, To* out, std::size_t count) noexcept
+    {
+        return detail::CastApply(in, out, count, detail::CastWrap<To>());
+    }
+
+    /**
+     * \brief Checked element wise conversion into a SnugInt array
+     *
+     * \details
+     * Failing elements are handed to the Policy P
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @tparam From integral type of in
+     * @param in array of count items
+     * @param out array receiving count converted items
+     * @param count number of elements
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class P, class From>
+    BatchResult cast(const From* in, SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        return detail::CastApply(in, detail::RawArray(out), count, detail::CastResolve<T, P>());
+    }
+
+    /**
+     * \brief Checked element wise conversion between SnugInt arrays
+     *
+     * \details
+     * Failing elements are handed to the Policy P of out
+     */
+    template<class T, class P, class F, class Q>
+    BatchResult cast(const SnugInt<F, Q>* in, SnugInt<T, P>* out, std::size_t count) noexcept(P::nothrow)
+    {
+        return detail::CastApply(detail::RawArray(in), detail::RawArray(out), count, detail::CastResolve<T, P>());
+    }
+}
@@ -0,0 +1,105 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGINT_CHARS_H
+#define PROJECT_SNUGINT_CHARS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// 8 digits are read as one little endian 64 bit word
+#ifndef SNUGINT_SWAR_DIGITS
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64)
+#define SNUGINT_SWAR_DIGITS 1
+#else
+#define SNUGINT_SWAR_DIGITS 0
+#endif
+#endif
+
+/**
+ * \brief Checked decimal parsing and formatting
+ *
+ * \details
+ * snug::from_chars and snug::to_chars work on a char range like their std counterparts, they never allocate,
+ * never look at the locale and accept only base 10: an optional '-' for signed types followed by digits, no
+ * leading whitespace and no '+'.
+ *
+ * \details
+ * - from_chars reads 8 digits at a time with SWAR on little endian targets and keeps at most 19 significant
+ *   digits in a 64 bit accumulator (38 in 128 bits for the 128 bit types), so overflow is known once the digits end. A value past max is
+ *   MultiplicationOverflow and one past min MultiplicationUnderflow (the digit that fails is the one the
+ *   accumulator is multiplied by 10 for), text without a digit is InvalidFormat. ptr ends after the last
+ *   digit, or at first for InvalidFormat, and value is only written on success
+ *
+ * \details
+ * - to_chars writes two digits per step from a 200 byte table of digit pairs, a 128 bit number is first split
+ *   into 19 digit chunks. A range too small for the number is SizeMismatch with ptr at last, nothing is terminated
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugInt<int> price;
+ *snug::FromCharsResult parsed = snug::from_chars(field, field_end, price);
+ *if (!parsed.ok())
+ *    // parsed.error is MultiplicationOverflow, MultiplicationUnderflow or InvalidFormat
+ *char text[snug::max_chars];
+ *snug::ToCharsResult written = snug::to_chars(text, text + sizeof(text), price);
+ * \endcode
+ */
+namespace snug
+{
+    constexpr std::size_t max_chars = SNUGINT_HAS_INT128 ? 40 : 21; /**< longest text of any integer, sign included */
+
+    /**
+     * \brief Result of from_chars
+     */
+    struct FromCharsResult
+    {
+        const char* ptr;    /**< first char not parsed */
+        SnugIntError error; /**< None when value was written */
+
+        constexpr bool ok() const noexcept { return error == SnugIntError::None; };
+    };
+
+    /**
+     * \brief Result of to_chars
+     */
+    struct ToCharsResult
+    {
+        char* ptr;          /**< one past the last char written */
+        SnugIntError error; /**< None when the number was written */
+
+        constexpr bool ok() const noexcept { return error == SnugIntError::None; };
+    };
+
+    template<class Type>
+    typename std::enable_if<detail::IsInteger<Type>::value, FromCharsResult>::type
+    from_chars(const char* first, const char* last, Type& value) noexcept;
+    template<class T, class P>
+    FromCharsResult from_chars(const char* first, const char* last, SnugInt<T, P>& value) noexcept;
+
+    template<class Type>
+    typename std::enable_if<detail::IsInteger<Type>::value, ToCharsResult>::type
+    to_chars(char* first, char* last, Type value) noexcept;
+    template<class T, class P>
+    ToCharsResult to_chars(char* first, char* last, const SnugInt<T, P>& value) noexcept;
+}
+
+#include "SnugIntChars.tpp"
+
+#endif //PROJECT_SNUGINT_CHARS_H
@@ -0,0 +1,274 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include "SnugIntChars.h"
+
+namespace snug
+{
+namespace detail
+{
+    // "00" to "99", the two digits of i at DigitPairs[2 * i]
+    constexpr char DigitPairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                  "8081828384858687888990919293949596979899";
+
+    /**
+     * \brief Checks that all 8 bytes of chunk are '0' to '9'
+     *
+     * \details
+     * A byte is a digit when its high nibble is 3 and adding 6 does not carry into the high nibble
+     */
+    constexpr bool EightDigits(std::uint64_t chunk) noexcept
+    {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0u) | (((chunk + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4))
+               == 0x3333333333333333u;
+    }
+
+    /**
+     * \brief Value of 8 digits read as a little endian word, first digit in the low byte
+     *
+     * \details
+     * Combines neighbouring digits into pairs, then pairs into fours, then the two fours
+     */
+    constexpr std::uint32_t ParseEightDigits(std::uint64_t chunk) noexcept
+    {
+        const std::uint64_t values = chunk - 0x3030303030303030u;
+        const std::uint64_t pairs = values * 10 + (values >> 8);
+        return static_cast<std::uint32_t>(((pairs & 0x000000FF000000FFu) * (100 + (1000000ull << 32))
+                                           + ((pairs >> 16) & 0x000000FF000000FFu) * (1 + (10000ull << 32))) >> 32);
+    }
+
+    /**
+     * \brief Number of decimal digits of item
+     */
+    template<class Unsigned>
+    inline unsigned CountDigits(Unsigned item) noexcept
+    {
+        unsigned digits = 1;
+        for (;;)
+        {
+            if (item < 10) return digits;
+            if (item < 100) return digits + 1;
+            if (item < 1000) return digits + 2;
+            if (item < 10000) return digits + 3;
+            item /= 10000u;
+            digits += 4;
+        }
+    }
+
+    constexpr std::uint64_t DigitChunk = 10000000000000000000u; /**< 10^19, the largest power of 10 in 64 bits */
+
+#if SNUGINT_HAS_INT128
+    /**
+     * \brief Number of decimal digits of a 128 bit item
+     */
+    inline unsigned CountDigits(unsigned __int128 item) noexcept
+    {
+        unsigned digits = 0;
+        for (; item > std::numeric_limits<std::uint64_t>::max(); item /= DigitChunk)
+            digits += 19;
+        return digits + CountDigits(static_cast<std::uint64_t>(item));
+    }
+#endif
+
+    /**
+     * \brief Writes the digits of item so that the last one is just before end
+     */
+    template<class Unsigned>
+    inline void WriteDigits(char* end, Unsigned item) noexcept
+    {
+        while (item >= 100)
+        {
+            const char* pair = DigitPairs + 2 * static_cast<unsigned>(item % 100);
+            item /= 100;
+            *--end = pair[1];
+            *--end = pair[0];
+        }
+        if (item < 10)
+        {
+            *--end = static_cast<char>('0' + item);
+            return;
+        }
+        *--end = DigitPairs[2 * item + 1];
+        *--end = DigitPairs[2 * item];
+    }
+
+    /**
+     * \brief Writes a chunk below DigitChunk as exactly 19 digits, leading zeros included, ending just before end
+     */
+    inline void WriteChunk(char* end, std::uint64_t chunk) noexcept
+    {
+        for (unsigned i = 0; i < 9; ++i, chunk /= 100)
+        {
+            const char* pair = DigitPairs + 2 * static_cast<unsigned>(chunk % 100);
+            *--end = pair[1];
+            *--end = pair[0];
+        }
+        *--end = static_cast<char>('0' + chunk);
+    }
+
+#if SNUGINT_HAS_INT128
+    /**
+     * \brief Writes the digits of a 128 bit item, 19 at a time with one 128 bit division each
+     */
+    inline void WriteDigits(char* end, unsigned __int128 item) noexcept
+    {
+        for (; item > std::numeric_limits<std::uint64_t>::max(); item /= DigitChunk, end -= 19)
+            WriteChunk(end, static_cast<std::uint64_t>(item % DigitChunk));
+        WriteDigits(end, static_cast<std::uint64_t>(item));
+    }
+#endif
+
+    /**
+     * \brief Widest accumulator of from_chars and to_chars for Type
+     */
+    template<class Type>
+    struct CharsMagnitude
+    {
+        typedef typename std::conditional<sizeof(Type) <= sizeof(std::uint32_t), std::uint32_t, std::uint64_t>::type type;
+    };
+
+#if SNUGINT_HAS_INT128
+    template<> struct CharsMagnitude<__int128> { typedef unsigned __int128 type; };
+    template<> struct CharsMagnitude<unsigned __int128> { typedef unsigned __int128 type; };
+#endif
+}
+}
+
+/**
+ * \brief Parses a decimal integer
+ *
+ * \details
+ * Leading zeros are skipped before counting significant digits, up to 19 of them (38 for 128 bit types) are
+ * accumulated unchecked (8 at a time while a whole word of digits is left), one more is checked against the
+ * accumulator and any more overflow. The magnitude is checked against max, or -min after a '-', once at the end
+ *
+ * @tparam Type integral to parse into
+ * @param first start of the text
+ * @param last end of the text
+ * @param value receives the number, untouched on error
+ * @return the end of the digits and None, MultiplicationOverflow, MultiplicationUnderflow or InvalidFormat
+ */
+template<class Type>
+typename std::enable_if<snug::detail::IsInteger<Type>::value, snug::FromCharsResult>::type
+snug::from_chars(const char* first, const char* last, Type& value) noexcept
+{
+    typedef typename detail::MakeUnsigned<Type>::type Unsigned;
+    typedef typename std::conditional<(sizeof(Type) > sizeof(std::uint64_t)), Unsigned, std::uint64_t>::type Magnitude;
+    constexpr std::ptrdiff_t exact = std::numeric_limits<Magnitude>::digits10; // digits that can not overflow
+
+    const char* p = first;
+    const bool negative = detail::IsSigned<Type>::value && p != last && *p == '-';
+    if (negative)
+        ++p;
+
+    const char* digits = p;
+    while (p != last && *p == '0')
+        ++p;
+
+    const char* significant = p;
+    Magnitude magnitude = 0;
+#if SNUGINT_SWAR_DIGITS
+    while (last - p >= 8 && p - significant <= exact - 8)
+    {   // 8 more digits still fit
+        std::uint64_t chunk;
+        std::memcpy(&chunk, p, sizeof(chunk));
+        if (!detail::EightDigits(chunk))
+            break;
+        magnitude = magnitude * 100000000u + detail::ParseEightDigits(chunk);
+        p += 8;
+    }
+#endif
+
+    bool overflow = false;
+    for (; p != last && static_cast<unsigned char>(*p - '0') < 10; ++p)
+    {
+        const unsigned digit = static_cast<unsigned char>(*p - '0');
+        if (p - significant < exact)
+            magnitude = magnitude * 10 + digit;
+        else if (p - significant > exact || magnitude > (std::numeric_limits<Magnitude>::max() - digit) / 10)
+            overflow = true;
+        else
+            magnitude = magnitude * 10 + digit;
+    }
+
+    SnugIntResult<Type> result = {0, SnugIntError::None};
+    const Magnitude limit = static_cast<Magnitude>(static_cast<Unsigned>(std::numeric_limits<Type>::max())) + negative;
+    if (p == digits)
+    {
+        p = first;
+        result.error = SnugIntError::InvalidFormat;
+    } else if (overflow || magnitude > limit)
+    {
+        result.error = negative ? SnugIntError::MultiplicationUnderflow : SnugIntError::MultiplicationOverflow;
+    } else
+    {
+        result.value = static_cast<Type>(negative ? static_cast<Unsigned>(0 - magnitude) : static_cast<Unsigned>(magnitude));
+        value = result.value;
+    }
+
+    return {p, detail::Record(SnugIntOperation::Convert, result).error};
+}
+
+/**
+ * \brief Parses a decimal integer into a SnugInt, see from_chars(const char*, const char*, Type&)
+ */
+template<class T, class P>
+snug::FromCharsResult snug::from_chars(const char* first, const char* last, SnugInt<T, P>& value) noexcept
+{
+    T item = 0;
+    const FromCharsResult result = from_chars(first, last, item);
+    if (result.ok())
+        value = item;
+    return result;
+}
+
+/**
+ * \brief Formats a decimal integer
+ *
+ * @tparam Type integral to format
+ * @param first start of the output
+ * @param last end of the output
+ * @param value number to write
+ * @return one past the last char and None, or last and SizeMismatch when the output is too small
+ */
+template<class Type>
+typename std::enable_if<snug::detail::IsInteger<Type>::value, snug::ToCharsResult>::type
+snug::to_chars(char* first, char* last, Type value) noexcept
+{
+    typedef typename detail::CharsMagnitude<Type>::type Unsigned;
+
+    const bool negative = detail::IsNegative(value);
+    const Unsigned magnitude = negative ? static_cast<Unsigned>(0 - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+    const unsigned length = detail::CountDigits(magnitude) + negative;
+    if (last - first < static_cast<std::ptrdiff_t>(length))
+        return {last, SnugIntError::SizeMismatch};
+
+    if (negative)
+        *first = '-';
+    detail::WriteDigits(first + length, magnitude);
+    return {first + length, SnugIntError::None};
+}
+
+/**
+ * \brief Formats the value of a SnugInt, see to_chars(char*, char*, Type)
+ */
+template<class T, class P>
+snug::ToCharsResult snug::to_chars(char* first, char* last, const SnugInt<T, P>& value) noexcept
+{
+    return to_chars(first, last, value.getValue());
+}
@@ -0,0 +1,116 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGINT_COLUMN_H
+#define PROJECT_SNUGINT_COLUMN_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SnugInt.h"
+#include "SnugIntBatch.h"
+
+#ifndef SNUGINT_SSE2_SCAN
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SNUGINT_SSE2_SCAN 1
+#else
+#define SNUGINT_SSE2_SCAN 0
+#endif
+#endif
+#if SNUGINT_SSE2_SCAN
+#include <emmintrin.h>
+#endif
+
+/**
+ * \brief Checked bulk decoding of delimited integer text
+ *
+ * \details
+ * Fills a preallocated array from a text buffer (a read block or a memory mapped file) in one pass. Fields
+ * end at delimiter or at a newline and a carriage return before the newline is dropped.
+ * The separators are found 16 bytes at a time with SSE2 compares where available, every field is parsed
+ * with snug::from_chars.
+ *
+ * \details
+ * - A bad field does not stop the decode, its element is written as 0 and its bit is set in the error
+ *   bitmap, one std::uint64_t per 64 elements (error_words(capacity) of them, bit i % 64 of word i / 64).
+ *   The first failure is reported like a BatchResult, the bitmap may be nullptr
+ *
+ * \details
+ * - decode_values takes every field as a value, an empty line is an empty field. decode_column takes only
+ *   field column of every line, skips empty lines and reports a line without the column as InvalidFormat.
+ *   A delimiter or newline that ends the text does not open another field
+ *
+ * \details
+ * - complete = false marks text that continues in a later buffer, the last unterminated field (line for
+ *   decode_column) is then left for the next call and ptr points at its start. Decoding also stops at
+ *   capacity elements, ptr then points at the field (line) to resume from
+ *
+ * \details
+ * - The SnugInt overloads write straight into the array through its raw layout and never consult the
+ *   Policy, failures are only reported
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *std::vector<SnugInt<std::int64_t>> amounts(rows);
+ *std::vector<std::uint64_t> errors(snug::error_words(rows));
+ *snug::ColumnResult result = snug::decode_column(text, text + size, ',', 3, amounts.data(), rows, errors.data());
+ *if (!result.ok())
+ *    // result.failed rows are flagged in errors, the first is amounts[result.index] with result.error
+ * \endcode
+ */
+namespace snug
+{
+    /**
+     * \brief Result of a bulk decode
+     */
+    struct ColumnResult
+    {
+        SnugIntError error; /**< error of the first failing element, SnugIntError::None on success */
+        std::size_t index;  /**< index of the first failing element, count on success */
+        std::size_t count;  /**< elements written */
+        std::size_t failed; /**< elements that failed and were written as 0 */
+        const char* ptr;    /**< first char not consumed */
+
+        constexpr bool ok() const noexcept { return error == SnugIntError::None; };
+        constexpr explicit operator bool() const noexcept { return ok(); };
+    };
+
+    /**
+     * \brief Number of bitmap words for count elements
+     */
+    constexpr std::size_t error_words(std::size_t count) noexcept { return (count + 63) / 64; };
+
+    // Every field
+    template<class T> ColumnResult decode_values(const char* first, const char* last, char delimiter, T* out,
+                                                 std::size_t capacity, std::uint64_t* errors = nullptr,
+                                                 bool complete = true) noexcept;
+    template<class T, class P> ColumnResult decode_values(const char* first, const char* last, char delimiter,
+                                                          SnugInt<T, P>* out, std::size_t capacity,
+                                                          std::uint64_t* errors = nullptr, bool complete = true) noexcept;
+
+    // One field of every line
+    template<class T> ColumnResult decode_column(const char* first, const char* last, char delimiter, std::size_t column,
+                                                 T* out, std::size_t capacity, std::uint64_t* errors = nullptr,
+                                                 bool complete = true) noexcept;
+    template<class T, class P> ColumnResult decode_column(const char* first, const char* last, char delimiter,
+                                                          std::size_t column, SnugInt<T, P>* out, std::size_t capacity,
+                                                          std::uint64_t* errors = nullptr, bool complete = true) noexcept;
+}
+
+#include "SnugIntColumn.tpp"
+
+#endif //PROJECT_SNUGINT_COLUMN_H
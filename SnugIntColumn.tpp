@@ -0,0 +1,368 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include "SnugIntColumn.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief Index of the lowest set bit of a non zero mask
+     */
+    inline unsigned LowestBit(std::uint32_t mask) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        unsigned index = 0;
+        while (!(mask & 1u))
+        {
+            mask >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    /**
+     * \brief Finds the delimiters and newlines of a text 16 bytes at a time
+     *
+     * \details
+     * Keeps the separator mask of the current block so short fields cost one bit scan each, never reads
+     * past last (the final partial block is scanned byte by byte)
+     */
+    class SeparatorScanner
+    {
+    public:
+        SeparatorScanner(const char* first, const char* end, char separator) noexcept
+            : block(first), last(end), delimiter(separator), mask(first != end ? Load() : 0u) {}
+
+        /**
+         * \brief The next separator, or last when there is none
+         */
+        const char* Next() noexcept
+        {
+            while (mask == 0)
+            {
+                if (last - block <= 16)
+                    return last;
+                block += 16;
+                mask = Load();
+            }
+            const char* separator = block + LowestBit(mask);
+            mask &= mask - 1;
+            return separator;
+        }
+    private:
+        const char* block;  /**< start of the scanned 16 bytes */
+        const char* last;   /**< end of the text */
+        char delimiter;     /**< field separator besides the newline */
+        std::uint32_t mask; /**< separators of block not yet returned */
+
+        std::uint32_t Load() const noexcept
+        {
+#if SNUGINT_SSE2_SCAN
+            if (last - block >= 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+                const __m128i separators = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(delimiter)),
+                                                        _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(separators));
+            }
+#endif
+            const std::ptrdiff_t size = last - block < 16 ? last - block : 16;
+            std::uint32_t found = 0;
+            for (std::ptrdiff_t i = 0; i < size; ++i)
+            {
+                if (block[i] == delimiter || block[i] == '\n')
+                    found |= 1u << i;
+            }
+            return found;
+        }
+    };
+
+    /**
+     * \brief Parses a field of at most 8 digits with one load and no loop
+     *
+     * \details
+     * The 8 bytes ending at end are loaded (the field and what precedes it in the text) and the bytes
+     * before the digits replaced by '0', so the digits read as one number with leading zeros. Anything
+     * else (longer fields, fields within 8 bytes of the start, non digits) is left to from_chars
+     *
+     * @param first start of the text, nothing before it is read
+     * @param begin start of the field
+     * @param end end of the field
+     * @param value receives the number, untouched on error
+     * @param error receives the error of the field
+     * @return false when the field needs from_chars
+     */
+    template<class T>
+    inline bool ParseShortField(const char* first, const char* begin, const char* end, T& value, SnugIntError& error) noexcept
+    {
+#if SNUGINT_SWAR_DIGITS
+        typedef typename MakeUnsigned<T>::type Unsigned;
+        const bool negative = IsSigned<T>::value && begin != end && *begin == '-';
+        const std::ptrdiff_t digits = end - begin - negative;
+        if (digits <= 0 || digits > 8 || end - first < 8)
+            return false;
+
+        std::uint64_t chunk;
+        std::memcpy(&chunk, end - 8, sizeof(chunk));
+        const std::uint64_t leading = digits == 8 ? 0u : ~std::uint64_t(0) >> (8 * digits); // bytes before the digits
+        chunk = (chunk & ~leading) | (0x3030303030303030u & leading);
+        if (!EightDigits(chunk))
+            return false;
+
+        const std::uint64_t magnitude = ParseEightDigits(chunk);
+        // the max of a 128 bit T does not fit in 64 bits, 8 digits always fit in it
+        const std::uint64_t limit = sizeof(T) > 8 ? ~std::uint64_t(0)
+                                                  : static_cast<std::uint64_t>(static_cast<Unsigned>(std::numeric_limits<T>::max())) + negative;
+        SnugIntResult<T> result = {0, SnugIntError::None};
+        if (magnitude > limit)
+            result.error = negative ? SnugIntError::MultiplicationUnderflow : SnugIntError::MultiplicationOverflow;
+        else
+        {
+            result.value = static_cast<T>(negative ? static_cast<Unsigned>(0 - static_cast<Unsigned>(magnitude)) : static_cast<Unsigned>(magnitude));
+            value = result.value;
+        }
+        error = Record(SnugIntOperation::Convert, result).error;
+        return true;
+#else
+        static_cast<void>(first);
+        static_cast<void>(begin);
+        static_cast<void>(end);
+        static_cast<void>(value);
+        static_cast<void>(error);
+        return false;
+#endif
+    }
+
+    /**
+     * \brief Writes element index of a decode and flags it in the bitmap
+     *
+     * \details
+     * The field is first tried with ParseShortField, then with from_chars which must consume all of it.
+     * A failed element is written as 0, the first failure is kept in result
+     */
+    template<class T>
+    inline void StoreField(const char* first, const char* begin, const char* end, T* out, std::uint64_t* errors,
+                           ColumnResult& result) noexcept
+    {
+        T value = 0;
+        SnugIntError error;
+        if (!ParseShortField(first, begin, end, value, error))
+        {
+            const FromCharsResult parsed = from_chars(begin, end, value);
+            error = parsed.ok() && parsed.ptr != end ? SnugIntError::InvalidFormat : parsed.error;
+        }
+
+        const std::size_t index = result.count++;
+        out[index] = error == SnugIntError::None ? value : static_cast<T>(0);
+        if (errors && (index & 63) == 0)
+            errors[index / 64] = 0;
+        if (error == SnugIntError::None)
+            return;
+
+        if (errors)
+            errors[index / 64] |= std::uint64_t(1) << (index & 63);
+        if (result.failed++ == 0)
+        {
+            result.error = error;
+            result.index = index;
+        }
+    }
+
+    /**
+     * \brief End of a field that ends at separator, without the carriage return of a line break
+     */
+    inline const char* FieldEnd(const char* field, const char* separator, const char* last) noexcept
+    {
+        return (separator == last || *separator == '\n') && separator != field && separator[-1] == '\r'
+               ? separator - 1 : separator;
+    }
+
+    /**
+     * \brief Loop of decode_values
+     *
+     * \details
+     * Incomplete text is cut after its last separator before the loop, so the loop only ever sees whole fields
+     */
+    template<class T>
+    ColumnResult DecodeValues(const char* first, const char* last, char delimiter, T* out, std::size_t capacity,
+                              std::uint64_t* errors, bool complete) noexcept
+    {
+        if (!complete)
+        {
+            while (last != first && last[-1] != '\n' && last[-1] != delimiter)
+                --last;
+        }
+
+        ColumnResult result = {SnugIntError::None, 0, 0, 0, last};
+        SeparatorScanner scanner(first, last, delimiter);
+        for (const char* field = first;;)
+        {
+            const char* separator = scanner.Next();
+            if (separator == last && field == last)
+                break; // a separator that ends the text closes the last field, it does not open one
+            if (result.count == capacity)
+            {
+                result.ptr = field;
+                break;
+            }
+
+            StoreField(first, field, FieldEnd(field, separator, last), out, errors, result);
+            if (separator == last)
+                break;
+            field = separator + 1;
+        }
+
+        if (result.ok())
+            result.index = result.count;
+        return result;
+    }
+
+    /**
+     * \brief Loop of decode_column
+     *
+     * \details
+     * Incomplete text is cut after its last newline before the loop, so the loop only ever sees whole lines
+     */
+    template<class T>
+    ColumnResult DecodeColumn(const char* first, const char* last, char delimiter, std::size_t column, T* out,
+                              std::size_t capacity, std::uint64_t* errors, bool complete) noexcept
+    {
+        if (!complete)
+        {
+            while (last != first && last[-1] != '\n')
+                --last;
+        }
+
+        ColumnResult result = {SnugIntError::None, 0, 0, 0, last};
+        SeparatorScanner scanner(first, last, delimiter);
+        const char* line = first;
+        const char* field = first;
+        std::size_t position = 0; // field index within the line
+        bool found = false;       // the line had its column
+        while (line != last)
+        {
+            const char* separator = scanner.Next();
+            const bool line_end = separator == last || *separator == '\n';
+            const char* end = FieldEnd(field, separator, last);
+
+            if (!(field == line && end == field && line_end))
+            {   // empty lines are skipped
+                if (position == column || (line_end && !found))
+                {   // the field of the column, or an empty one for a line that is too short
+                    if (result.count == capacity)
+                    {
+                        result.ptr = line;
+                        break;
+                    }
+                    StoreField(first, field, position == column ? end : field, out, errors, result);
+                    found = true;
+                }
+            }
+
+            if (separator == last)
+                break;
+            field = separator + 1;
+            ++position;
+            if (line_end)
+            {
+                line = field;
+                position = 0;
+                found = false;
+            }
+        }
+
+        if (result.ok())
+            result.index = result.count;
+        return result;
+    }
+}
+}
+
+/**
+ * \brief Decodes every delimited field of a text
+ *
+ * @tparam T integral type of the elements
+ * @param first start of the text
+ * @param last end of the text
+ * @param delimiter separator of fields, newlines always separate
+ * @param out array of at least capacity elements
+ * @param capacity most elements to write
+ * @param errors bitmap of error_words(capacity) words, or nullptr
+ * @param complete false when the text continues in a later buffer
+ * @return the first failing element, the counts and the first char not consumed
+ */
+template<class T>
+snug::ColumnResult snug::decode_values(const char* first, const char* last, char delimiter, T* out,
+                                       std::size_t capacity, std::uint64_t* errors, bool complete) noexcept
+{
+    return detail::DecodeValues(first, last, delimiter, out, capacity, errors, complete);
+}
+
+/**
+ * \brief Decodes every delimited field of a text into a SnugInt array
+ */
+template<class T, class P>
+snug::ColumnResult snug::decode_values(const char* first, const char* last, char delimiter, SnugInt<T, P>* out,
+                                       std::size_t capacity, std::uint64_t* errors, bool complete) noexcept
+{
+    return detail::DecodeValues(first, last, delimiter, detail::RawArray(out), capacity, errors, complete);
+}
+
+/**
+ * \brief Decodes one field of every line of a text
+ *
+ * @tparam T integral type of the elements
+ * @param first start of the text
+ * @param last end of the text
+ * @param delimiter separator of fields within a line
+ * @param column index of the field to decode, 0 for the first
+ * @param out array of at least capacity elements
+ * @param capacity most elements to write
+ * @param errors bitmap of error_words(capacity) words, or nullptr
+ * @param complete false when the text continues in a later buffer
+ * @return the first failing element, the counts and the first char not consumed
+ */
+template<class T>
+snug::ColumnResult snug::decode_column(const char* first, const char* last, char delimiter, std::size_t column,
+                                       T* out, std::size_t capacity, std::uint64_t* errors, bool complete) noexcept
+{
+    return detail::DecodeColumn(first, last, delimiter, column, out, capacity, errors, complete);
+}
+
+/**
+ * \brief Decodes one field of every line of a text into a SnugInt array
+ */
+template<class T, class P>
+snug::ColumnResult snug::decode_column(const char* first, const char* last, char delimiter, std::size_t column,
+                                       SnugInt<T, P>* out, std::size_t capacity, std::uint64_t* errors,
+                                       bool complete) noexcept
+{
+    return detail::DecodeColumn(first, last, delimiter, column, detail::RawArray(out), capacity, errors, complete);
+}
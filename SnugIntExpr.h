@@ -0,0 +1,143 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGINT_EXPR_H
+#define PROJECT_SNUGINT_EXPR_H
+
+#include "SnugInt.h"
+#include "SnugWide.h"
+
+namespace snug
+{
+namespace detail
+{
+    struct ExprAddTag {};
+    struct ExprSubTag {};
+    struct ExprMultTag {};
+
+    // 2^exponent
+    constexpr double ExprPower(int exponent) noexcept
+    {
+        return exponent == 0 ? 1.0 : (exponent < 0 ? ExprPower(exponent + 1) / 2.0 : 2.0 * ExprPower(exponent - 1));
+    }
+
+    /**
+     * \brief Operand of a checked expression holding a plain value
+     *
+     * \details
+     * bound is an upper bound of the magnitude of the operand
+     */
+    template<class T>
+    struct ExprLeaf
+    {
+        static constexpr double bound = ExprPower(std::numeric_limits<T>::digits);
+
+        T value; /**< value of the operand */
+
+        template<class Wide> constexpr Wide Eval() const noexcept;
+        template<class Wide> constexpr Wide EvalChecked(bool& overflow) const noexcept;
+    };
+
+    // Upper bound of the magnitude of an operation on operands bounded by left and right
+    constexpr double ExprBound(ExprAddTag, double left, double right) noexcept { return left + right; }
+    constexpr double ExprBound(ExprSubTag, double left, double right) noexcept { return left + right; }
+    constexpr double ExprBound(ExprMultTag, double left, double right) noexcept { return left * right; }
+
+    /**
+     * \brief Inner node of a checked expression
+     *
+     * \details
+     * Holds the operands by value, nothing is evaluated until the expression is converted
+     * to a SnugInt or Try is called
+     */
+    template<class Op, class L, class R>
+    class ExprNode
+    {
+    public:
+        static constexpr double bound = ExprBound(Op(), L::bound, R::bound);
+
+        constexpr ExprNode(const L& first, const R& second) noexcept : left(first), right(second) {}
+
+        // Non throwing evaluation, the result is range checked once against T
+        template<class T> constexpr SnugIntResult<T> Try() const noexcept;
+
+        // Evaluation into a SnugInt, a failed result is handed to P
+        template<class T, class P> constexpr operator SnugInt<T, P>() const noexcept(P::nothrow);
+
+        template<class Wide> constexpr Wide Eval() const noexcept;
+        template<class Wide> constexpr Wide EvalChecked(bool& overflow) const noexcept;
+    private:
+        L left;  /**< left operand */
+        R right; /**< right operand */
+    };
+}
+
+    // Starts a checked expression
+    template<class T, class P> constexpr detail::ExprLeaf<T> expr(const SnugInt<T, P>& item) noexcept;
+    template<class T> constexpr typename std::enable_if<detail::IsInteger<T>::value, detail::ExprLeaf<T>>::type expr(T item) noexcept;
+}
+
+/**
+ * \brief Checked expression templates
+ *
+ * \details
+ * snug::expr starts an expression, +, - and * on it build the expression tree instead of a checked
+ * SnugInt at every step. The magnitude bound of every node is computed at compile time from the operand
+ * types, when the tree is converted to a SnugInt it is evaluated in the smallest of long long, __int128
+ * and a 256 bit SnugWide that the bound shows can not overflow, and the result is range checked once against the destination.
+ * N checks in a chain become one.
+ *
+ * \details
+ * - Operands can be expressions, SnugInts of any type and integrals, the Policy is the one of the destination
+ *
+ * \details
+ * - A failing result is reported as an overflow or underflow of the outermost operation
+ *
+ * \details
+ * - A tree whose bound does not fit in 256 bits (e.g. more than three 64 bit products) is evaluated with
+ *   an overflow flag per step in the SnugWide, still with a single check at the end.
+ *   An intermediate that does not fit in the SnugWide is reported as an overflow.
+ *   Without __int128 the bounds between 63 and 255 bits go straight to the SnugWide
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugInt<long> price = snug::expr(quantity) * unit + fee - discount;  // one check
+ *SnugIntResult<int> result = (snug::expr(a) * b + c).Try<int>();
+ * \endcode
+ */
+namespace snug
+{
+namespace detail
+{
+    template<class L, class R, class = void> struct ExprOperands;
+
+    template<class L, class R>
+    using ExprAdd = ExprNode<ExprAddTag, typename ExprOperands<L, R>::left, typename ExprOperands<L, R>::right>;
+    template<class L, class R>
+    using ExprSub = ExprNode<ExprSubTag, typename ExprOperands<L, R>::left, typename ExprOperands<L, R>::right>;
+    template<class L, class R>
+    using ExprMult = ExprNode<ExprMultTag, typename ExprOperands<L, R>::left, typename ExprOperands<L, R>::right>;
+
+    // Mathematical Operators, at least one operand is an expression
+    template<class L, class R> constexpr ExprAdd<L, R> operator+(const L& left, const R& right) noexcept;
+    template<class L, class R> constexpr ExprSub<L, R> operator-(const L& left, const R& right) noexcept;
+    template<class L, class R> constexpr ExprMult<L, R> operator*(const L& left, const R& right) noexcept;
+}
+}
+
+#include "SnugIntExpr.tpp"
+
+#endif //PROJECT_SNUGINT_EXPR_H
@@ -0,0 +1,335 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include "SnugIntExpr.h"
+
+template<class T> constexpr double snug::detail::ExprLeaf<T>::bound;
+template<class Op, class L, class R> constexpr double snug::detail::ExprNode<Op, L, R>::bound;
+
+namespace snug
+{
+namespace detail
+{
+    // Bound below which the magnitude fits in a signed integer of 2^exponent, with margin for the rounding of the bound
+    constexpr bool ExprBelow(double bound, int exponent) noexcept
+    {
+        return bound < ExprPower(exponent) * (1.0 - ExprPower(-40));
+    }
+
+    /**
+     * \brief Wide type an expression with a magnitude bound of Bound is evaluated in
+     *
+     * \details
+     * exact is set when the bound shows the evaluation can not overflow, past 127 bits the
+     * expression is evaluated in a 256 bit SnugWide
+     */
+#if defined(__SIZEOF_INT128__)
+    template<class Node>
+    struct ExprWide
+    {
+        typedef typename std::conditional<ExprBelow(Node::bound, 63), long long,
+                typename std::conditional<ExprBelow(Node::bound, 127), __int128,
+                                          SnugWide<256, SnugIntWrapPolicy>>::type>::type type;
+        static constexpr bool exact = ExprBelow(Node::bound, 255);
+    };
+#else
+    template<class Node>
+    struct ExprWide
+    {
+        typedef typename std::conditional<ExprBelow(Node::bound, 63), long long, SnugWide<256, SnugIntWrapPolicy>>::type type;
+        static constexpr bool exact = ExprBelow(Node::bound, 255);
+    };
+#endif
+
+    // One step of the checked evaluation, overflow is set and never cleared
+    constexpr long long ExprStep(ExprAddTag, long long left, long long right, bool& overflow) noexcept
+    {
+        const SnugIntResult<long long> result = SnugInt<long long, SnugIntWrapPolicy>::TryAdd(left, right);
+        overflow |= !result.ok();
+        return result.value;
+    }
+
+    constexpr long long ExprStep(ExprSubTag, long long left, long long right, bool& overflow) noexcept
+    {
+        const SnugIntResult<long long> result = SnugInt<long long, SnugIntWrapPolicy>::TrySub(left, right);
+        overflow |= !result.ok();
+        return result.value;
+    }
+
+    constexpr long long ExprStep(ExprMultTag, long long left, long long right, bool& overflow) noexcept
+    {
+        const SnugIntResult<long long> result = SnugInt<long long, SnugIntWrapPolicy>::TryMult(left, right);
+        overflow |= !result.ok();
+        return result.value;
+    }
+
+    // Range check of the evaluated expression against T
+    template<class T>
+    constexpr bool ExprFits(long long item) noexcept
+    {   // the unsigned types of 64 bits and more reach past long long, their lower bound is 0
+        return sizeof(T) > sizeof(long long) && IsSigned<T>::value ? true
+               : sizeof(T) < sizeof(long long) || IsSigned<T>::value
+               ? item >= static_cast<long long>(std::numeric_limits<T>::min()) &&
+                 item <= static_cast<long long>(std::numeric_limits<T>::max())
+               : item >= 0;
+    }
+
+#if defined(__SIZEOF_INT128__)
+    constexpr __int128 ExprStep(ExprAddTag, __int128 left, __int128 right, bool& overflow) noexcept
+    {
+        __int128 result = 0;
+        overflow |= __builtin_add_overflow(left, right, &result);
+        return result;
+    }
+
+    constexpr __int128 ExprStep(ExprSubTag, __int128 left, __int128 right, bool& overflow) noexcept
+    {
+        __int128 result = 0;
+        overflow |= __builtin_sub_overflow(left, right, &result);
+        return result;
+    }
+
+    constexpr __int128 ExprStep(ExprMultTag, __int128 left, __int128 right, bool& overflow) noexcept
+    {
+        __int128 result = 0;
+        overflow |= __builtin_mul_overflow(left, right, &result);
+        return result;
+    }
+
+    template<class T>
+    constexpr bool ExprFits(__int128 item) noexcept
+    {   // only unsigned __int128 reaches past __int128, its lower bound is 0
+        return sizeof(T) < sizeof(__int128) || IsSigned<T>::value
+               ? item >= static_cast<__int128>(std::numeric_limits<T>::min()) &&
+                 item <= static_cast<__int128>(std::numeric_limits<T>::max())
+               : item >= 0;
+    }
+#endif
+
+    template<std::size_t Bits, class P>
+    constexpr SnugWide<Bits, P> ExprStep(ExprAddTag, const SnugWide<Bits, P>& left, const SnugWide<Bits, P>& right,
+                                         bool& overflow) noexcept
+    {
+        const SnugIntResult<SnugWide<Bits, P>> result = SnugWide<Bits, P>::TryAdd(left, right);
+        overflow |= !result.ok();
+        return result.value;
+    }
+
+    template<std::size_t Bits, class P>
+    constexpr SnugWide<Bits, P> ExprStep(ExprSubTag, const SnugWide<Bits, P>& left, const SnugWide<Bits, P>& right,
+                                         bool& overflow) noexcept
+    {
+        const SnugIntResult<SnugWide<Bits, P>> result = SnugWide<Bits, P>::TrySub(left, right);
+        overflow |= !result.ok();
+        return result.value;
+    }
+
+    template<std::size_t Bits, class P>
+    constexpr SnugWide<Bits, P> ExprStep(ExprMultTag, const SnugWide<Bits, P>& left, const SnugWide<Bits, P>& right,
+                                         bool& overflow) noexcept
+    {
+        const SnugIntResult<SnugWide<Bits, P>> result = SnugWide<Bits, P>::TryMult(left, right);
+        overflow |= !result.ok();
+        return result.value;
+    }
+
+    template<class T, std::size_t Bits, class P>
+    constexpr bool ExprFits(const SnugWide<Bits, P>& item) noexcept
+    {
+        return item.template TryTo<T>().ok();
+    }
+
+    // Exact operation of the unchecked evaluation
+    template<class Wide> constexpr Wide ExprApply(ExprAddTag, Wide left, Wide right) noexcept { return left + right; }
+    template<class Wide> constexpr Wide ExprApply(ExprSubTag, Wide left, Wide right) noexcept { return left - right; }
+    template<class Wide> constexpr Wide ExprApply(ExprMultTag, Wide left, Wide right) noexcept { return left * right; }
+
+    // Error reported for a result that does not fit, by outermost operation
+    constexpr SnugIntError ExprError(ExprAddTag, bool negative) noexcept
+    {
+        return negative ? SnugIntError::AdditionUnderflow : SnugIntError::AdditionOverflow;
+    }
+
+    constexpr SnugIntError ExprError(ExprSubTag, bool negative) noexcept
+    {
+        return negative ? SnugIntError::SubtractionUnderflow : SnugIntError::SubtractionOverflow;
+    }
+
+    constexpr SnugIntError ExprError(ExprMultTag, bool negative) noexcept
+    {
+        return negative ? SnugIntError::MultiplicationUnderflow : SnugIntError::MultiplicationOverflow;
+    }
+
+    // Leaf values are widened, only an unsigned 64 bit value in a long long can fail
+    template<class Wide, class T>
+    constexpr bool ExprLeafFits(T, std::true_type) noexcept
+    {
+        return true;
+    }
+
+    template<class Wide, class T>
+    constexpr bool ExprLeafFits(T item, std::false_type) noexcept
+    {
+        return Fits<Wide>(item);
+    }
+
+    template<class T>
+    template<class Wide>
+    constexpr Wide ExprLeaf<T>::Eval() const noexcept
+    {
+        return static_cast<Wide>(value);
+    }
+
+    template<class T>
+    template<class Wide>
+    constexpr Wide ExprLeaf<T>::EvalChecked(bool& overflow) const noexcept
+    {
+        overflow |= !ExprLeafFits<Wide>(value, std::integral_constant<bool, (sizeof(Wide) > sizeof(T))>());
+        return static_cast<Wide>(value);
+    }
+
+    template<class Op, class L, class R>
+    template<class Wide>
+    constexpr Wide ExprNode<Op, L, R>::Eval() const noexcept
+    {
+        return ExprApply<Wide>(Op(), left.template Eval<Wide>(), right.template Eval<Wide>());
+    }
+
+    template<class Op, class L, class R>
+    template<class Wide>
+    constexpr Wide ExprNode<Op, L, R>::EvalChecked(bool& overflow) const noexcept
+    {
+        const Wide first = left.template EvalChecked<Wide>(overflow);
+        const Wide second = right.template EvalChecked<Wide>(overflow);
+        return ExprStep(Op(), first, second, overflow);
+    }
+
+    template<class Op, class L, class R, class T>
+    constexpr SnugIntResult<T> ExprTry(const ExprNode<Op, L, R>& node, std::true_type) noexcept
+    {
+        typedef typename ExprWide<ExprNode<Op, L, R>>::type Wide;
+        const Wide wide = node.template Eval<Wide>();
+        SnugIntResult<T> result = {static_cast<T>(wide), SnugIntError::None};
+        if (!ExprFits<T>(wide))
+            result.error = ExprError(Op(), wide < 0);
+        return result;
+    }
+
+    template<class Op, class L, class R, class T>
+    constexpr SnugIntResult<T> ExprTry(const ExprNode<Op, L, R>& node, std::false_type) noexcept
+    {
+        typedef typename ExprWide<ExprNode<Op, L, R>>::type Wide;
+        bool overflow = false;
+        const Wide wide = node.template EvalChecked<Wide>(overflow);
+        SnugIntResult<T> result = {static_cast<T>(wide), SnugIntError::None};
+        if (overflow | !ExprFits<T>(wide))
+            result.error = ExprError(Op(), !overflow && wide < 0);
+        return result;
+    }
+
+    template<class Op, class L, class R>
+    template<class T>
+    constexpr SnugIntResult<T> ExprNode<Op, L, R>::Try() const noexcept
+    {
+        static_assert(IsInteger<T>::value, "an expression evaluates to an integral");
+        return ExprTry<Op, L, R, T>(*this, std::integral_constant<bool, ExprWide<ExprNode>::exact>());
+    }
+
+    template<class Op, class L, class R>
+    template<class T, class P>
+    constexpr ExprNode<Op, L, R>::operator SnugInt<T, P>() const noexcept(P::nothrow)
+    {
+        const SnugIntResult<T> result = Try<T>();
+        const bool negative = result.error == SnugIntError::AdditionUnderflow ||
+                              result.error == SnugIntError::SubtractionUnderflow ||
+                              result.error == SnugIntError::MultiplicationUnderflow;
+        return SnugInt<T, P>(SnugInt<T, P>::Resolve(result, negative ? std::numeric_limits<T>::min()
+                                                                      : std::numeric_limits<T>::max()));
+    }
+
+    template<class X> struct IsExpr : std::false_type {};
+    template<class T> struct IsExpr<ExprLeaf<T>> : std::true_type {};
+    template<class Op, class L, class R> struct IsExpr<ExprNode<Op, L, R>> : std::true_type {};
+
+    /**
+     * \brief Operand of an expression operator as an expression
+     */
+    template<class X, class = void>
+    struct ExprLift : std::false_type {};
+
+    template<class X>
+    struct ExprLift<X, typename std::enable_if<IsInteger<X>::value>::type> : std::true_type
+    {
+        typedef ExprLeaf<X> type;
+        static constexpr type Make(X item) noexcept { return type{item}; }
+    };
+
+    template<class T, class P>
+    struct ExprLift<SnugInt<T, P>> : std::true_type
+    {
+        typedef ExprLeaf<T> type;
+        static constexpr type Make(const SnugInt<T, P>& item) noexcept { return type{item.getValue()}; }
+    };
+
+    template<class X>
+    struct ExprLift<X, typename std::enable_if<IsExpr<X>::value>::type> : std::true_type
+    {
+        typedef X type;
+        static constexpr const X& Make(const X& item) noexcept { return item; }
+    };
+
+    template<class L, class R, class>
+    struct ExprOperands {};
+
+    template<class L, class R>
+    struct ExprOperands<L, R, typename std::enable_if<(IsExpr<L>::value || IsExpr<R>::value) &&
+                                                      ExprLift<L>::value && ExprLift<R>::value>::type>
+    {
+        typedef typename ExprLift<L>::type left;
+        typedef typename ExprLift<R>::type right;
+    };
+
+    template<class L, class R>
+    constexpr ExprAdd<L, R> operator+(const L& left, const R& right) noexcept
+    {
+        return ExprAdd<L, R>(ExprLift<L>::Make(left), ExprLift<R>::Make(right));
+    }
+
+    template<class L, class R>
+    constexpr ExprSub<L, R> operator-(const L& left, const R& right) noexcept
+    {
+        return ExprSub<L, R>(ExprLift<L>::Make(left), ExprLift<R>::Make(right));
+    }
+
+    template<class L, class R>
+    constexpr ExprMult<L, R> operator*(const L& left, const R& right) noexcept
+    {
+        return ExprMult<L, R>(ExprLift<L>::Make(left), ExprLift<R>::Make(right));
+    }
+}
+
+    template<class T, class P>
+    constexpr detail::ExprLeaf<T> expr(const SnugInt<T, P>& item) noexcept
+    {
+        return detail::ExprLeaf<T>{item.getValue()};
+    }
+
+    template<class T>
+    constexpr typename std::enable_if<detail::IsInteger<T>::value, detail::ExprLeaf<T>>::type expr(T item) noexcept
+    {
+        return detail::ExprLeaf<T>{item};
+    }
+}
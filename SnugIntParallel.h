@@ -0,0 +1,98 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGINT_PARALLEL_H
+#define PROJECT_SNUGINT_PARALLEL_H
+
+#include <cstddef>
+
+#include "SnugInt.h"
+#include "SnugIntBatch.h"
+#include "SnugIntReduce.h"
+
+/**
+ * \brief Multi threaded checked reductions and transforms
+ *
+ * \details
+ * The input is split into cache sized chunks that the calling thread and up to threads - 1 workers
+ * take from a shared counter. Every chunk keeps its own result, sums are reduced per chunk into the
+ * 128 bit accumulator of SnugIntReduce.h and merged in chunk order with a single range check at the end.
+ *
+ * \details
+ * - Overflow reporting is deterministic, the lowest failing index wins whatever the scheduling
+ *
+ * \details
+ * - threads = 0 uses std::thread::hardware_concurrency(), inputs of a single chunk run on the calling thread
+ *
+ * \details
+ * - The SnugInt overloads hand the failure to the Policy on the calling thread, so a SnugIntThrowPolicy
+ *   array throws from the caller (never from a worker) and SnugIntFlagPolicy raises the callers flag. A
+ *   failure is counted once by telemetry and the profile, where it was resolved
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugIntResult<long> total = snug::parallel_sum(values, count);
+ *snug::BatchResult result = snug::parallel_transform(prices, fees, totals, count, snug::AddOp());
+ * \endcode
+ */
+namespace snug
+{
+    /**
+     * \brief Batch operations as function objects for parallel_transform
+     */
+    struct AddOp
+    {
+        template<class L, class R, class O>
+        BatchResult operator()(L left, R right, O out, std::size_t count) const { return add(left, right, out, count); }
+    };
+
+    struct SubOp
+    {
+        template<class L, class R, class O>
+        BatchResult operator()(L left, R right, O out, std::size_t count) const { return sub(left, right, out, count); }
+    };
+
+    struct MulOp
+    {
+        template<class L, class R, class O>
+        BatchResult operator()(L left, R right, O out, std::size_t count) const { return mul(left, right, out, count); }
+    };
+
+    // Reductions
+    template<class T> SnugIntResult<T> parallel_sum(const T* data, std::size_t count, unsigned threads = 0);
+    template<class T, class P> SnugInt<T, P> parallel_sum(const SnugInt<T, P>* data, std::size_t count,
+                                                          unsigned threads = 0);
+
+    // Transforms (array, array)
+    template<class T, class Op> BatchResult parallel_transform(const T* left, const T* right, T* out,
+                                                               std::size_t count, Op op, unsigned threads = 0);
+    template<class T, class P, class Op> BatchResult parallel_transform(const SnugInt<T, P>* left,
+                                                                        const SnugInt<T, P>* right,
+                                                                        SnugInt<T, P>* out, std::size_t count,
+                                                                        Op op, unsigned threads = 0);
+
+    // Transforms (array, scalar)
+    template<class T, class Op> BatchResult parallel_transform(const T* left, T right, T* out,
+                                                               std::size_t count, Op op, unsigned threads = 0);
+    template<class T, class P, class Op> BatchResult parallel_transform(const SnugInt<T, P>* left,
+                                                                        SnugInt<T, P> right,
+                                                                        SnugInt<T, P>* out, std::size_t count,
+                                                                        Op op, unsigned threads = 0);
+}
+
+#include "SnugIntParallel.tpp"
+
+#endif //PROJECT_SNUGINT_PARALLEL_H
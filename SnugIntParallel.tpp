@@ -0,0 +1,373 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "SnugIntParallel.h"
+
+namespace snug
+{
+namespace detail
+{
+    /** bytes of input per chunk, small enough for the chunk and its output to stay in L2 */
+    constexpr std::size_t ParallelChunkBytes = std::size_t(1) << 16;
+
+    template<class T>
+    constexpr std::size_t ParallelChunk() noexcept
+    {
+        return ParallelChunkBytes / sizeof(T);
+    }
+
+    template<class T>
+    constexpr std::size_t ParallelChunks(std::size_t count) noexcept
+    {
+        return (count + ParallelChunk<T>() - 1) / ParallelChunk<T>();
+    }
+
+    /**
+     * \brief Number of threads to run, never more than there are chunks
+     */
+    inline unsigned ParallelThreads(unsigned threads, std::size_t chunks) noexcept
+    {
+        if (threads == 0)
+            threads = std::thread::hardware_concurrency();
+        if (threads == 0)
+            threads = 1;
+        return chunks < threads ? static_cast<unsigned>(chunks) : threads;
+    }
+
+    /**
+     * \brief Runs work for every chunk on the calling thread and threads - 1 workers
+     *
+     * \details
+     * Chunks are handed out through a shared counter, a worker that can not be started is simply
+     * not there, the remaining threads (at least the calling one) still run every chunk. Without exceptions
+     * a failed start can not be caught and ends the program
+     *
+     * @tparam Work callable taking a chunk index, must not throw
+     * @param chunks number of chunks
+     * @param threads number of threads including the calling thread
+     * @param work called once for every chunk index
+     */
+    template<class Work>
+    void ParallelFor(std::size_t chunks, unsigned threads, const Work& work)
+    {
+        std::atomic<std::size_t> next(0);
+        const auto run = [&]() noexcept
+        {
+            for (std::size_t chunk = next.fetch_add(1, std::memory_order_relaxed); chunk < chunks;
+                 chunk = next.fetch_add(1, std::memory_order_relaxed))
+                work(chunk);
+        };
+
+        std::vector<std::thread> workers;
+#if SNUGINT_HAS_EXCEPTIONS
+        try
+        {
+            workers.reserve(threads > 1 ? threads - 1 : 0);
+            for (unsigned i = 1; i < threads; ++i)
+                workers.emplace_back(run);
+        } catch (const std::system_error&)
+        {   // out of threads, go on with the ones that started
+        } catch (const std::bad_alloc&)
+        {
+        }
+#else
+        workers.reserve(threads > 1 ? threads - 1 : 0);
+        for (unsigned i = 1; i < threads; ++i)
+            workers.emplace_back(run);
+#endif
+
+        run();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    /**
+     * \brief Runs a batch operation over every chunk and keeps the lowest failing index
+     *
+     * @tparam T integral type of the elements
+     * @tparam Chunk callable running the operation for (start, size)
+     * @param count number of elements
+     * @param threads requested number of threads, 0 for hardware_concurrency()
+     * @param chunk called once for every chunk
+     * @return the first failing element, or the element count on success
+     */
+    template<class T, class Chunk>
+    BatchResult ParallelTransform(std::size_t count, unsigned threads, const Chunk& chunk)
+    {
+        const std::size_t chunks = ParallelChunks<T>(count);
+        std::vector<BatchResult> results(chunks);
+
+        ParallelFor(chunks, ParallelThreads(threads, chunks), [&](std::size_t index) noexcept
+        {
+            const std::size_t start = index * ParallelChunk<T>();
+            const std::size_t size = count - start < ParallelChunk<T>() ? count - start : ParallelChunk<T>();
+
+            BatchResult result = chunk(start, size);
+            result.index = result.ok() ? count : start + result.index;
+            results[index] = result;
+        });
+
+        for (const BatchResult& result : results)
+        {
+            if (!result.ok())
+                return result;
+        }
+
+        BatchResult result = {SnugIntError::None, count};
+        return result;
+    }
+
+    /**
+     * \brief Arrays the workers of a SnugInt parallel_transform operate on
+     *
+     * \details
+     * A nothrow Policy runs per element in the workers, a throwing Policy must not throw from a worker
+     * so the workers run the raw (wrapping) operation and the caller resolves the first failure
+     */
+    template<class T, class P, bool Nothrow = P::nothrow>
+    struct ParallelView
+    {
+        static const SnugInt<T, P>* In(const SnugInt<T, P>* data) noexcept { return data; }
+        static SnugInt<T, P>* Out(SnugInt<T, P>* data) noexcept { return data; }
+        static SnugInt<T, P> Scalar(SnugInt<T, P> item) noexcept { return item; }
+    };
+
+    template<class T, class P>
+    struct ParallelView<T, P, false>
+    {
+        static const T* In(const SnugInt<T, P>* data) noexcept { return RawArray(data); }
+        static T* Out(SnugInt<T, P>* data) noexcept { return RawArray(data); }
+        static T Scalar(SnugInt<T, P> item) noexcept { return item.getValue(); }
+    };
+
+    /**
+     * \brief Hands the first failure of a SnugInt parallel_transform to the Policy on the calling thread
+     *
+     * \details
+     * With a throwing Policy the workers ran the raw operation, so the failure is resolved here for the first
+     * time. A nothrow Policy already resolved it in a worker (telemetry and profile sites counted it there),
+     * the caller only hands the error to Policy::OnError again so a per thread state like the flag of
+     * SnugIntFlagPolicy is raised on the calling thread too
+     */
+    template<class T, class P>
+    BatchResult ParallelResolve(const BatchResult& result, const SnugInt<T, P>* out, std::false_type)
+    {
+        if (!result.ok())
+        {
+            const SnugIntResult<T> element = {out[result.index].getValue(), result.error};
+            SnugInt<T, P>::Resolve(element);
+        }
+        return result;
+    }
+
+    template<class T, class P>
+    BatchResult ParallelResolve(const BatchResult& result, const SnugInt<T, P>* out, std::true_type) noexcept
+    {
+#if SNUGINT_MODE == SNUGINT_MODE_CHECKED
+        if (!result.ok())
+        {
+            const T item = out[result.index].getValue();
+            static_cast<void>(P::template OnError<T>(result.error, item, item));
+        }
+#else
+        static_cast<void>(out);
+#endif
+        return result;
+    }
+
+    template<class T, class P>
+    BatchResult ParallelResolve(const BatchResult& result, const SnugInt<T, P>* out)
+    {
+        return ParallelResolve(result, out, std::integral_constant<bool, P::nothrow>());
+    }
+}
+
+    /**
+     * \brief Overflow safe sum of an array on multiple threads
+     *
+     * \details
+     * Every chunk is summed exactly into its own accumulator, the chunk totals are merged in order
+     * and range checked once, the result is the same as snug::sum
+     *
+     * @tparam T integral type of the elements
+     * @param data array to be summed
+     * @param count number of elements
+     * @param threads number of threads including the calling thread, 0 for hardware_concurrency()
+     * @return the sum, or AdditionOverflow / AdditionUnderflow
+     */
+    template<class T>
+    SnugIntResult<T> parallel_sum(const T* data, std::size_t count, unsigned threads)
+    {
+        const std::size_t chunks = detail::ParallelChunks<T>(count);
+        if (chunks <= 1)
+            return sum(data, count);
+
+        typedef typename detail::SumTotal<T>::type Total;
+        std::vector<Total> totals(chunks);
+        detail::ParallelFor(chunks, detail::ParallelThreads(threads, chunks), [&](std::size_t index) noexcept
+        {
+            const std::size_t start = index * detail::ParallelChunk<T>();
+            const std::size_t size = count - start < detail::ParallelChunk<T>() ? count - start
+                                                                                : detail::ParallelChunk<T>();
+            totals[index] = detail::SumOf(data + start, size, detail::SumKind<T>());
+        });
+
+        Total total = {};
+        for (const Total& item : totals)
+            total.Add(item);
+
+        return detail::Narrow<T>(total, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow);
+    }
+
+    /**
+     * \brief Overflow safe sum of a SnugInt array on multiple threads
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy, decides a sum that does not fit
+     * @param data array to be summed
+     * @param count number of elements
+     * @param threads number of threads including the calling thread, 0 for hardware_concurrency()
+     * @return the sum
+     */
+    template<class T, class P>
+    SnugInt<T, P> parallel_sum(const SnugInt<T, P>* data, std::size_t count, unsigned threads)
+    {
+        return SnugInt<T, P>::Resolve(parallel_sum(detail::RawArray(data), count, threads));
+    }
+
+    /**
+     * \brief Checked element wise operation on multiple threads
+     *
+     * \details
+     * Every chunk runs op on its own part of the arrays, out is written as by the batch operation
+     *
+     * @tparam T integral type of the elements
+     * @tparam Op batch operation, AddOp, SubOp or MulOp
+     * @param left left operand array
+     * @param right right operand array
+     * @param out array receiving count results
+     * @param count number of elements
+     * @param op batch operation to run, must not throw
+     * @param threads number of threads including the calling thread, 0 for hardware_concurrency()
+     * @return the lowest failing element, or the element count on success
+     */
+    template<class T, class Op>
+    BatchResult parallel_transform(const T* left, const T* right, T* out, std::size_t count, Op op, unsigned threads)
+    {
+        return detail::ParallelTransform<T>(count, threads, [&](std::size_t start, std::size_t size) noexcept
+        {
+            return op(left + start, right + start, out + start, size);
+        });
+    }
+
+    /**
+     * \brief Checked element wise operation of SnugInt arrays on multiple threads
+     *
+     * \details
+     * The lowest failing element is handed to the Policy P on the calling thread. A nothrow Policy
+     * also decides every failing element, with a throwing Policy out holds the wrapped results
+     * of all elements when the exception leaves
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @tparam Op batch operation, AddOp, SubOp or MulOp
+     * @param left left operand array
+     * @param right right operand array
+     * @param out array receiving count results
+     * @param count number of elements
+     * @param op batch operation to run
+     * @param threads number of threads including the calling thread, 0 for hardware_concurrency()
+     * @return the lowest failing element, or the element count on success
+     */
+    template<class T, class P, class Op>
+    BatchResult parallel_transform(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                                   SnugInt<T, P>* out, std::size_t count, Op op, unsigned threads)
+    {
+        typedef detail::ParallelView<T, P> View;
+        const auto l = View::In(left);
+        const auto r = View::In(right);
+        const auto o = View::Out(out);
+
+        const BatchResult result = detail::ParallelTransform<T>(count, threads,
+                                                                [&](std::size_t start, std::size_t size) noexcept
+        {
+            return op(l + start, r + start, o + start, size);
+        });
+        return detail::ParallelResolve(result, out);
+    }
+
+    /**
+     * \brief Checked element wise operation with a scalar on multiple threads
+     *
+     * @tparam T integral type of the elements
+     * @tparam Op batch operation, AddOp, SubOp or MulOp
+     * @param left left operand array
+     * @param right right operand used for every element
+     * @param out array receiving count results
+     * @param count number of elements
+     * @param op batch operation to run, must not throw
+     * @param threads number of threads including the calling thread, 0 for hardware_concurrency()
+     * @return the lowest failing element, or the element count on success
+     */
+    template<class T, class Op>
+    BatchResult parallel_transform(const T* left, T right, T* out, std::size_t count, Op op, unsigned threads)
+    {
+        return detail::ParallelTransform<T>(count, threads, [&](std::size_t start, std::size_t size) noexcept
+        {
+            return op(left + start, right, out + start, size);
+        });
+    }
+
+    /**
+     * \brief Checked element wise operation of a SnugInt array with a scalar on multiple threads
+     *
+     * \details
+     * The lowest failing element is handed to the Policy P on the calling thread
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy
+     * @tparam Op batch operation, AddOp, SubOp or MulOp
+     * @param left left operand array
+     * @param right right operand used for every element
+     * @param out array receiving count results
+     * @param count number of elements
+     * @param op batch operation to run
+     * @param threads number of threads including the calling thread, 0 for hardware_concurrency()
+     * @return the lowest failing element, or the element count on success
+     */
+    template<class T, class P, class Op>
+    BatchResult parallel_transform(const SnugInt<T, P>* left, SnugInt<T, P> right,
+                                   SnugInt<T, P>* out, std::size_t count, Op op, unsigned threads)
+    {
+        typedef detail::ParallelView<T, P> View;
+        const auto l = View::In(left);
+        const auto r = View::Scalar(right);
+        const auto o = View::Out(out);
+
+        const BatchResult result = detail::ParallelTransform<T>(count, threads,
+                                                                [&](std::size_t start, std::size_t size) noexcept
+        {
+            return op(l + start, r, o + start, size);
+        });
+        return detail::ParallelResolve(result, out);
+    }
+}
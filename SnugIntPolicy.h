@@ -0,0 +1,148 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGINT_POLICY_H
+#define PROJECT_SNUGINT_POLICY_H
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define SNUGINT_TRAP() __fastfail(7)
+#elif defined(__GNUC__) || defined(__clang__)
+#define SNUGINT_TRAP() __builtin_trap()
+#else
+#include <cstdlib>
+#define SNUGINT_TRAP() std::abort()
+#endif
+
+/**
+ * \brief SnugInt overflow policies
+ *
+ * \details
+ * The second template parameter of SnugInt decides what happens when an operation fails.
+ * A policy provides
+ * \code
+ *static constexpr bool nothrow;      // true if OnError never throws, operators become noexcept
+ *template<class Type>
+ *static Type OnError(SnugIntError error, Type wrapped, Type saturated);
+ * \endcode
+ * where wrapped is the two's complement result of the operation and saturated is the
+ * closest value to the real result that fits in Type. The returned value is stored.
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugInt<short, SnugIntSaturatePolicy> sample = 32000;
+ *sample = sample + 1000; // 32767
+ * \endcode
+ */
+
+/**
+ * \brief Throws the exception matching the error, the default policy
+ */
+struct SnugIntThrowPolicy
+{
+    static constexpr bool nothrow = SNUGINT_MODE != SNUGINT_MODE_CHECKED; // OnError is never reached otherwise
+
+    template<class Type>
+    static constexpr Type OnError(SnugIntError error, Type wrapped, Type)
+    {
+        SnugIntRaise(error);
+        return wrapped;
+    }
+};
+
+/**
+ * \brief Clamps the result to the bounds of Type
+ */
+struct SnugIntSaturatePolicy
+{
+    static constexpr bool nothrow = true;
+
+    template<class Type>
+    static constexpr Type OnError(SnugIntError, Type, Type saturated) noexcept
+    {
+        return saturated;
+    }
+};
+
+/**
+ * \brief Keeps the two's complement result, like the raw integral would
+ */
+struct SnugIntWrapPolicy
+{
+    static constexpr bool nothrow = true;
+
+    template<class Type>
+    static constexpr Type OnError(SnugIntError, Type wrapped, Type) noexcept
+    {
+        return wrapped;
+    }
+};
+
+/**
+ * \brief Terminates the process immediately on error
+ */
+struct SnugIntTrapPolicy
+{
+    static constexpr bool nothrow = true;
+
+    template<class Type>
+    static constexpr Type OnError(SnugIntError, Type wrapped, Type) noexcept
+    {
+        SNUGINT_TRAP();
+        return wrapped;
+    }
+};
+
+/**
+ * \brief Keeps the wrapped result and raises a sticky per thread flag
+ *
+ * \details
+ * The first error since the last clear() is remembered, so a batch of operations
+ * can be checked once at the end.
+ * \code
+ *SnugIntFlagPolicy::clear();
+ *for (...)
+ *    total += item;
+ *if (SnugIntFlagPolicy::overflowed())
+ *    // handle SnugIntFlagPolicy::error()
+ * \endcode
+ */
+struct SnugIntFlagPolicy
+{
+    static constexpr bool nothrow = true;
+
+    template<class Type>
+    static constexpr Type OnError(SnugIntError error, Type wrapped, Type) noexcept
+    {
+        SnugIntError& flag = state();
+        if (flag == SnugIntError::None)
+            flag = error;
+        return wrapped;
+    }
+
+    static bool overflowed() noexcept { return state() != SnugIntError::None; };
+    static SnugIntError error() noexcept { return state(); };
+    static void clear() noexcept { state() = SnugIntError::None; };
+
+private:
+    static SnugIntError& state() noexcept
+    {
+        static thread_local SnugIntError flag = SnugIntError::None;
+        return flag;
+    }
+};
+
+#endif //PROJECT_SNUGINT_POLICY_H
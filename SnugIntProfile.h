@@ -0,0 +1,296 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGINT_PROFILE_H
+#define PROJECT_SNUGINT_PROFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#ifndef SNUGINT_PROFILE
+#define SNUGINT_PROFILE 0
+#endif
+
+#ifndef SNUGINT_PROFILE_SLOTS
+#define SNUGINT_PROFILE_SLOTS 1024
+#endif
+
+#if SNUGINT_PROFILE
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+
+#if !SNUGINT_HAS_CONSTANT_EVALUATED
+#error "SNUGINT_PROFILE needs __builtin_is_constant_evaluated or std::is_constant_evaluated to keep SnugInt constexpr"
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SNUGINT_PROFILE_HOOK __attribute__((noinline, cold))
+#define SNUGINT_RETURN_ADDRESS() __builtin_return_address(0)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define SNUGINT_PROFILE_HOOK __declspec(noinline)
+#define SNUGINT_RETURN_ADDRESS() _ReturnAddress()
+#else
+#error "SNUGINT_PROFILE needs __builtin_return_address or _ReturnAddress"
+#endif
+#endif
+
+/**
+ * \brief A place in the program where checks failed
+ */
+struct SnugIntSite
+{
+    const void* address;    /**< return address into the code that did the failing operation */
+    SnugIntError error;     /**< the error of the failures */
+    std::uint64_t count;    /**< number of failures */
+};
+
+/**
+ * \brief Overflow site profiler
+ *
+ * \details
+ * With SNUGINT_PROFILE defined to 1 every failed check that reaches the Policy (the checked operators,
+ * SafeAdd, SafeSub, ...) is counted by the address it failed at and its SnugIntError. The failing path calls a
+ * noinline hook, once the operator is inlined its return address is a place in the function that did the
+ * operation, which addr2line, a debugger or pprof turn into a source line. Without inlining (-O0) every
+ * site is inside SnugInt itself.
+ *
+ * \details
+ * The sites live in a fixed table of SNUGINT_PROFILE_SLOTS (a power of two) open addressed slots shared by
+ * all threads, a failure costs a hash, a compare exchange the first time a site is seen and a relaxed
+ * increment, no lock and no allocation. Once the table is full new sites are only counted in dropped().
+ * Without SNUGINT_PROFILE nothing is recorded and every dump is empty.
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *for (const SnugIntSite& site : SnugIntProfile::top(10))
+ *    std::cerr << site.address << " " << site.count << "\n";
+ *std::ofstream out("snugint.prof", std::ios::binary);
+ *SnugIntProfile::write_pprof(out);                 // pprof --text ./server snugint.prof
+ * \endcode
+ */
+class SnugIntProfile
+{
+public:
+    static constexpr bool enabled = SNUGINT_PROFILE != 0;
+    static constexpr std::size_t slots = SNUGINT_PROFILE_SLOTS;
+
+    static std::vector<SnugIntSite> top(std::size_t count);
+    static std::uint64_t dropped() noexcept;
+    static void write_top(std::ostream& out, std::size_t count);
+    static void write_pprof(std::ostream& out);
+};
+
+static_assert(SNUGINT_PROFILE_SLOTS > 0 && (SNUGINT_PROFILE_SLOTS & (SNUGINT_PROFILE_SLOTS - 1)) == 0,
+              "SNUGINT_PROFILE_SLOTS must be a power of two");
+
+namespace snug
+{
+namespace detail
+{
+#if SNUGINT_PROFILE
+    /**
+     * \brief One site of the profile table
+     *
+     * \details
+     * key packs the address and the error, key 0 is a free slot. A slot is claimed once and never freed
+     */
+    struct ProfileSlot
+    {
+        std::atomic<std::uint64_t> key;
+        std::atomic<std::uint64_t> count;
+    };
+
+    struct ProfileTable
+    {
+        ProfileSlot sites[SNUGINT_PROFILE_SLOTS];
+        std::atomic<std::uint64_t> dropped;
+    };
+
+    inline ProfileTable& Profile() noexcept
+    {   // constant initialized, usable from any static constructor or destructor
+        static ProfileTable table;
+        return table;
+    }
+
+    // the error takes the low 5 bits of the key, user space addresses leave the top bits unused
+    constexpr unsigned ProfileErrorBits = 5;
+
+    static_assert(static_cast<unsigned>(SnugIntError::InvalidFormat) < (1u << ProfileErrorBits),
+                  "every SnugIntError must fit in the key of a ProfileSlot");
+
+    /**
+     * \brief Counts a failure of error at address
+     *
+     * \details
+     * Linear probing from a multiplicative hash of the key, at most 32 slots are looked at
+     */
+    inline void ProfileRecord(const void* address, SnugIntError error) noexcept
+    {
+        const std::uint64_t key = (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(address)) << ProfileErrorBits)
+                                  | static_cast<std::uint64_t>(error);
+        ProfileTable& table = Profile();
+
+        std::size_t index = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+        for (unsigned probe = 0; probe < 32; ++probe, ++index)
+        {
+            ProfileSlot& slot = table.sites[index & (SNUGINT_PROFILE_SLOTS - 1)];
+            std::uint64_t current = slot.key.load(std::memory_order_relaxed);
+            if (current == 0 && slot.key.compare_exchange_strong(current, key, std::memory_order_relaxed))
+                current = key;
+            if (current == key)
+            {
+                slot.count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        table.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief The failing path of SnugInt::Resolve
+     *
+     * \details
+     * Never inlined, so the return address is the place the failing operation was inlined into
+     */
+    SNUGINT_PROFILE_HOOK inline void ProfileFailure(SnugIntError error) noexcept
+    {
+        ProfileRecord(SNUGINT_RETURN_ADDRESS(), error);
+    }
+#endif
+
+    /**
+     * \brief Records a failed check at the calling site
+     *
+     * \details
+     * Called by SnugInt::Resolve before the Policy, compiles to nothing without SNUGINT_PROFILE
+     *
+     * @param error the error of the failed check
+     */
+    constexpr void ProfileError(SnugIntError error) noexcept
+    {
+#if SNUGINT_PROFILE
+        if (!SNUGINT_IS_CONSTANT_EVALUATED())
+            ProfileFailure(error);
+#else
+        static_cast<void>(error);
+#endif
+    }
+}
+}
+
+/**
+ * \brief The sites with the most failures
+ *
+ * \details
+ * Reads the table with relaxed loads while other threads may still be adding to it
+ *
+ * @param count number of sites to return at most
+ * @return sites sorted by failures, the most first
+ */
+inline std::vector<SnugIntSite> SnugIntProfile::top(std::size_t count)
+{
+    std::vector<SnugIntSite> sites;
+#if SNUGINT_PROFILE
+    for (const snug::detail::ProfileSlot& slot : snug::detail::Profile().sites)
+    {
+        const std::uint64_t key = slot.key.load(std::memory_order_relaxed);
+        if (key == 0)
+            continue;
+
+        SnugIntSite site = {reinterpret_cast<const void*>(static_cast<std::uintptr_t>(key >> snug::detail::ProfileErrorBits)),
+                            static_cast<SnugIntError>(key & ((1u << snug::detail::ProfileErrorBits) - 1)),
+                            slot.count.load(std::memory_order_relaxed)};
+        sites.push_back(site);
+    }
+
+    std::sort(sites.begin(), sites.end(), [](const SnugIntSite& left, const SnugIntSite& right) { return left.count > right.count; });
+    if (sites.size() > count)
+        sites.resize(count);
+#else
+    static_cast<void>(count);
+#endif
+    return sites;
+}
+
+/**
+ * \brief Failures that found the table full
+ *
+ * @return failures not counted by any site
+ */
+inline std::uint64_t SnugIntProfile::dropped() noexcept
+{
+#if SNUGINT_PROFILE
+    return snug::detail::Profile().dropped.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * \brief Writes the top sites as text
+ *
+ * \details
+ * One line per site, "count error address", the addresses can be fed to addr2line -e <binary>
+ * after subtracting the load address of a position independent binary
+ *
+ * @param out stream to write to
+ * @param count number of sites to write at most
+ */
+inline void SnugIntProfile::write_top(std::ostream& out, std::size_t count)
+{
+    for (const SnugIntSite& site : top(count))
+        out << site.count << ' ' << snug::detail::ErrorNames[static_cast<std::size_t>(site.error)] << ' ' << site.address << '\n';
+    if (dropped() > 0)
+        out << dropped() << " dropped\n";
+}
+
+/**
+ * \brief Writes every site as a pprof profile
+ *
+ * \details
+ * Uses the legacy binary CPU profile format of gperftools, which pprof reads and symbolizes against the
+ * binary: a header, one sample of the failure count per site with a one frame stack, the trailer and
+ * on Linux the contents of /proc/self/maps so pprof can map the addresses of shared objects and PIE binaries
+ *
+ * @param out binary stream to write to
+ */
+inline void SnugIntProfile::write_pprof(std::ostream& out)
+{
+    std::vector<std::uintptr_t> words = {0, 3, 0, 1, 0};   // header, version 0, sampling period 1
+#if SNUGINT_PROFILE
+    for (const SnugIntSite& site : top(slots))
+    {
+        words.push_back(static_cast<std::uintptr_t>(site.count));
+        words.push_back(1);
+        words.push_back(reinterpret_cast<std::uintptr_t>(site.address));
+    }
+#endif
+    words.insert(words.end(), {0, 1, 0});                   // trailer
+
+    out.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(words.size() * sizeof(std::uintptr_t)));
+#if SNUGINT_PROFILE && defined(__linux__)
+    std::ifstream maps("/proc/self/maps");
+    out << maps.rdbuf();
+#endif
+}
+
+#endif //PROJECT_SNUGINT_PROFILE_H
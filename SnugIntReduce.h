@@ -0,0 +1,70 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGINT_REDUCE_H
+#define PROJECT_SNUGINT_REDUCE_H
+
+#include <cstddef>
+
+#include "SnugInt.h"
+#include "SnugIntBatch.h"
+#include "SnugWide.h"
+
+/**
+ * \brief Checked reductions over arrays
+ *
+ * \details
+ * Overflow safe sum, product and dot product. Instead of checking every step the reductions accumulate
+ * in a type that provably can not overflow for the block being reduced (a block of 32 bit values is
+ * summed in 64 bits, the block totals in 128 bits) and do the range check once at the end.
+ * The result is exact, an intermediate overflow that is cancelled out later is not an error.
+ *
+ * \details
+ * - The raw overloads never throw, they return a SnugIntResult with AdditionOverflow / AdditionUnderflow
+ *   (sum, dot) or MultiplicationOverflow / MultiplicationUnderflow (product) when the result does not fit
+ *
+ * \details
+ * - The SnugInt overloads hand a failed result to the SnugInt Policy
+ *
+ * \details
+ * - dot over 64 bit types needs __int128, without it a product that does not fit is reported on its own
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugIntResult<int> total = snug::sum(values, count);
+ *if (!total.ok())
+ *{
+ *    // handle total.error
+ *}
+ * \endcode
+ */
+namespace snug
+{
+    // Raw arrays
+    template<class T> SnugIntResult<T> sum(const T* data, std::size_t count) noexcept;
+    template<class T> SnugIntResult<T> product(const T* data, std::size_t count) noexcept;
+    template<class T> SnugIntResult<T> dot(const T* left, const T* right, std::size_t count) noexcept;
+
+    // SnugInt arrays
+    template<class T, class P> SnugInt<T, P> sum(const SnugInt<T, P>* data, std::size_t count) noexcept(P::nothrow);
+    template<class T, class P> SnugInt<T, P> product(const SnugInt<T, P>* data, std::size_t count) noexcept(P::nothrow);
+    template<class T, class P> SnugInt<T, P> dot(const SnugInt<T, P>* left, const SnugInt<T, P>* right,
+                                                 std::size_t count) noexcept(P::nothrow);
+}
+
+#include "SnugIntReduce.tpp"
+
+#endif //PROJECT_SNUGINT_REDUCE_H
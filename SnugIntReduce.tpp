@@ -0,0 +1,480 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include "SnugIntReduce.h"
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief 128 bit two's complement accumulator
+     *
+     * \details
+     * Portable stand in for __int128, it can absorb 2^64 values of 64 bits without overflowing
+     */
+    struct Accumulator
+    {
+        unsigned long long low;
+        long long high;
+
+        constexpr void Add(long long item) noexcept
+        {
+            const unsigned long long bits = static_cast<unsigned long long>(item);
+            low += bits;
+            high += (low < bits ? 1 : 0) + (item < 0 ? -1 : 0);
+        }
+
+        constexpr void Add(unsigned long long item) noexcept
+        {
+            low += item;
+            high += low < item ? 1 : 0;
+        }
+
+        constexpr void Add(const Accumulator& other) noexcept
+        {
+            low += other.low;
+            high += (low < other.low ? 1 : 0) + other.high;
+        }
+    };
+
+    /**
+     * \brief Narrows an Accumulator to T
+     *
+     * @tparam T integral type of the result
+     * @param total accumulated value
+     * @param overflow error reported when total is above the max of T
+     * @param underflow error reported when total is below the min of T
+     * @return total as T, or overflow / underflow with the wrapped value
+     */
+    template<class T>
+    constexpr SnugIntResult<T> Narrow(const Accumulator& total, SnugIntError overflow, SnugIntError underflow) noexcept
+    {
+        SnugIntResult<T> result = {static_cast<T>(total.low), SnugIntError::None};
+
+        if (IsSigned<T>::value)
+        {
+            const long long item = static_cast<long long>(total.low);
+            if (total.high != (item < 0 ? -1 : 0))
+                result.error = total.high < 0 ? underflow : overflow;
+            else if (item > static_cast<long long>(std::numeric_limits<T>::max()))
+                result.error = overflow;
+            else if (item < static_cast<long long>(std::numeric_limits<T>::min()))
+                result.error = underflow;
+        } else
+        {
+            if (total.high < 0)
+                result.error = underflow;
+            else if (total.high > 0 || total.low > static_cast<unsigned long long>(std::numeric_limits<T>::max()))
+                result.error = overflow;
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief The widest accumulator of the same signedness as T
+     */
+    template<class T>
+    struct Widest
+    {
+        typedef typename std::conditional<IsSigned<T>::value, long long, unsigned long long>::type type;
+    };
+
+    /** elements summed in 64 bits before the block total is moved to the Accumulator */
+    constexpr std::size_t ReduceBlock = std::size_t(1) << 30;
+
+    /**
+     * \brief 192 bit accumulator for the 128 bit types
+     *
+     * \details
+     * Same interface as Accumulator, backed by a SnugWide so it can absorb 2^64 values of 128 bits
+     */
+    struct WideAccumulator
+    {
+        SnugWide<192, SnugIntWrapPolicy> total;
+
+        template<class T>
+        void Add(T item) noexcept
+        {
+            total += item;
+        }
+
+        void Add(const WideAccumulator& other) noexcept
+        {
+            total += other.total;
+        }
+    };
+
+    /**
+     * \brief Narrows a WideAccumulator to T, a total that does not fit is reported by its sign
+     */
+    template<class T>
+    SnugIntResult<T> Narrow(const WideAccumulator& total, SnugIntError overflow, SnugIntError underflow) noexcept
+    {
+        SnugIntResult<T> result = total.total.template TryTo<T>();
+        if (!result.ok())
+            result.error = total.total.isNegative() ? underflow : overflow;
+        return result;
+    }
+
+    /**
+     * \brief Accumulator a sum of T is taken in
+     */
+    template<class T>
+    struct SumTotal
+    {
+        typedef typename std::conditional<(sizeof(T) > 8), WideAccumulator, Accumulator>::type type;
+    };
+
+    template<class T>
+    struct SumKind : std::integral_constant<int, sizeof(T) < 8 ? 0 : (sizeof(T) == 8 ? 1 : 2)> {};
+
+    /**
+     * \brief Sums types narrower than 64 bits
+     *
+     * \details
+     * Each block of up to 2^30 elements is summed with plain 64 bit additions (which vectorize),
+     * 2^30 values of 32 bits can not overflow 64 bits
+     */
+    template<class T>
+    Accumulator SumOf(const T* data, std::size_t count, std::integral_constant<int, 0>) noexcept
+    {
+        typedef typename Widest<T>::type Wide;
+        Accumulator total = {0, 0};
+
+        for (std::size_t start = 0; start < count; start += ReduceBlock)
+        {
+            const std::size_t end = count - start < ReduceBlock ? count : start + ReduceBlock;
+            Wide block = 0;
+
+            for (std::size_t i = start; i < end; ++i)
+                block += data[i];
+
+            total.Add(block);
+        }
+
+        return total;
+    }
+
+    /**
+     * \brief Sums 64 bit types straight into the Accumulator
+     */
+    template<class T>
+    Accumulator SumOf(const T* data, std::size_t count, std::integral_constant<int, 1>) noexcept
+    {
+        typedef typename Widest<T>::type Wide;
+        Accumulator total = {0, 0};
+
+        for (std::size_t i = 0; i < count; ++i)
+            total.Add(static_cast<Wide>(data[i]));
+
+        return total;
+    }
+
+    /**
+     * \brief Sums 128 bit types into the WideAccumulator
+     */
+    template<class T>
+    WideAccumulator SumOf(const T* data, std::size_t count, std::integral_constant<int, 2>) noexcept
+    {
+        WideAccumulator total = {};
+
+        for (std::size_t i = 0; i < count; ++i)
+            total.Add(data[i]);
+
+        return total;
+    }
+
+    /**
+     * \brief Dot product of 8 and 16 bit types
+     *
+     * \details
+     * A product is at most 2^32, so a block of 2^30 products can not overflow 64 bits
+     */
+    template<class T>
+    Accumulator DotOf(const T* left, const T* right, std::size_t count, std::integral_constant<int, 0>) noexcept
+    {
+        typedef typename Widest<T>::type Wide;
+        Accumulator total = {0, 0};
+
+        for (std::size_t start = 0; start < count; start += ReduceBlock)
+        {
+            const std::size_t end = count - start < ReduceBlock ? count : start + ReduceBlock;
+            Wide block = 0;
+
+            for (std::size_t i = start; i < end; ++i)
+                block += static_cast<Wide>(left[i]) * static_cast<Wide>(right[i]);
+
+            total.Add(block);
+        }
+
+        return total;
+    }
+
+    /**
+     * \brief Dot product of 32 bit types
+     *
+     * \details
+     * Every product is exact in 64 bits and goes straight into the Accumulator
+     */
+    template<class T>
+    Accumulator DotOf(const T* left, const T* right, std::size_t count, std::integral_constant<int, 1>) noexcept
+    {
+        typedef typename Widest<T>::type Wide;
+        Accumulator total = {0, 0};
+
+        for (std::size_t i = 0; i < count; ++i)
+            total.Add(static_cast<Wide>(static_cast<Wide>(left[i]) * static_cast<Wide>(right[i])));
+
+        return total;
+    }
+
+    /**
+     * \brief Dot product of 64 bit types
+     *
+     * \details
+     * Every product is exact in 128 bits, the sum counts the times it wrapped past 128 bits
+     * so a cancelled out intermediate overflow is still exact
+     */
+    template<class T>
+    SnugIntResult<T> DotOf64(const T* left, const T* right, std::size_t count) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        typedef typename std::conditional<IsSigned<T>::value, __int128, unsigned __int128>::type Wide;
+        Wide total = 0;
+        long long wraps = 0;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Wide item = static_cast<Wide>(left[i]) * static_cast<Wide>(right[i]);
+            if (__builtin_add_overflow(total, item, &total))
+                wraps += item < 0 ? -1 : 1;
+        }
+
+        SnugIntResult<T> result = {static_cast<T>(total), SnugIntError::None};
+        if (wraps < 0 || (wraps == 0 && total < static_cast<Wide>(std::numeric_limits<T>::min())))
+            result.error = SnugIntError::AdditionUnderflow;
+        else if (wraps > 0 || total > static_cast<Wide>(std::numeric_limits<T>::max()))
+            result.error = SnugIntError::AdditionOverflow;
+        return result;
+#else
+        Accumulator total = {0, 0};
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            SnugIntResult<T> item = SnugInt<T, SnugIntWrapPolicy>::TryMult(left[i], right[i]);
+            if (!item.ok())
+                return item;
+            total.Add(static_cast<typename Widest<T>::type>(item.value));
+        }
+
+        return Narrow<T>(total, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow);
+#endif
+    }
+
+    template<class T>
+    SnugIntResult<T> DotOf(const T* left, const T* right, std::size_t count, std::integral_constant<int, 2>) noexcept
+    {
+        return DotOf64(left, right, count);
+    }
+
+    /**
+     * \brief Dot product of 128 bit types
+     *
+     * \details
+     * Every product is exact in 256 bits, summed in a 320 bit SnugWide that can absorb 2^64 of them
+     */
+    template<class T>
+    SnugIntResult<T> DotOf(const T* left, const T* right, std::size_t count, std::integral_constant<int, 3>) noexcept
+    {
+        typedef SnugWide<320, SnugIntWrapPolicy> Wide;
+        Wide total;
+
+        for (std::size_t i = 0; i < count; ++i)
+            total += Wide(left[i]) * Wide(right[i]);
+
+        SnugIntResult<T> result = total.template TryTo<T>();
+        if (!result.ok())
+            result.error = total.isNegative() ? SnugIntError::AdditionUnderflow : SnugIntError::AdditionOverflow;
+        return result;
+    }
+
+    template<class T>
+    struct DotKind : std::integral_constant<int, sizeof(T) <= 2 ? 0 : (sizeof(T) == 4 ? 1 : (sizeof(T) == 8 ? 2 : 3))> {};
+
+    /**
+     * \brief Narrows the result of DotOf
+     */
+    template<class T>
+    SnugIntResult<T> DotResult(const Accumulator& total) noexcept
+    {
+        return Narrow<T>(total, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow);
+    }
+
+    template<class T>
+    SnugIntResult<T> DotResult(const SnugIntResult<T>& result) noexcept
+    {
+        return result;
+    }
+}
+
+    /**
+     * \brief Overflow safe sum of an array
+     *
+     * \details
+     * Accumulates in a wider type with one range check at the end, the result is exact
+     *
+     * @tparam T integral type of the elements
+     * @param data array to be summed
+     * @param count number of elements
+     * @return the sum, or AdditionOverflow / AdditionUnderflow
+     */
+    template<class T>
+    SnugIntResult<T> sum(const T* data, std::size_t count) noexcept
+    {
+        typename detail::SumTotal<T>::type total = detail::SumOf(data, count, detail::SumKind<T>());
+        return detail::Narrow<T>(total, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow);
+    }
+
+    /**
+     * \brief Overflow safe product of an array
+     *
+     * \details
+     * Multiplies with the checked arithmetic backend. After the first overflow the product keeps wrapping
+     * and its exact magnitude is carried on until it no longer fits the magnitude type, so a later zero
+     * still gives 0, a product that lands exactly on min (int8 -64 * -2 * -1) still fits and the sign of
+     * the real product decides between overflow and underflow
+     *
+     * @tparam T integral type of the elements
+     * @param data array to be multiplied
+     * @param count number of elements
+     * @return the product, or MultiplicationOverflow / MultiplicationUnderflow
+     */
+    template<class T>
+    SnugIntResult<T> product(const T* data, std::size_t count) noexcept
+    {
+        SnugIntResult<T> result = {1, SnugIntError::None};
+        T step = 1;
+        std::size_t i = 0;
+
+        for (; i < count; ++i)
+        {
+            step = result.value;
+            if (detail::MultOverflow(step, data[i], &result.value))
+                break;
+        }
+
+        if (i == count)
+            return result;
+
+        // overflowed, the magnitude of nonzero factors never shrinks, so only a zero or a product of
+        // exactly min can still fit
+        typedef typename detail::ExactMagnitude<T>::type Magnitude;
+        typedef typename std::conditional<(sizeof(T) > 8), typename detail::MakeUnsigned<T>::type, unsigned long long>::type Bits;
+        detail::BasicExact<Magnitude> exact = detail::ExactMult(detail::ExactOf<T, Magnitude>(step), detail::ExactOf<T, Magnitude>(data[i]));
+        bool wide = exact.wide;
+        bool negative = false;
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            if (j > i)
+            {
+                result.value = static_cast<T>(static_cast<Bits>(result.value) * static_cast<Bits>(data[j]));
+                if (!wide)
+                {
+                    exact = detail::ExactMult(exact, detail::ExactOf<T, Magnitude>(data[j]));
+                    wide = exact.wide;
+                }
+            }
+            if (data[j] == 0)
+            {
+                result.value = 0;
+                return result;
+            }
+            negative ^= data[j] < 0;
+        }
+
+        if (!wide && detail::ExactFits<T>(exact))
+            return result;
+
+        result.error = negative ? SnugIntError::MultiplicationUnderflow : SnugIntError::MultiplicationOverflow;
+        return result;
+    }
+
+    /**
+     * \brief Overflow safe dot product of two arrays
+     *
+     * \details
+     * Every product is exact in a wider type and the sum is checked once at the end
+     *
+     * @tparam T integral type of the elements
+     * @param left array to be multiplied with right
+     * @param right array to be multiplied with left
+     * @param count number of elements
+     * @return the dot product, or AdditionOverflow / AdditionUnderflow
+     */
+    template<class T>
+    SnugIntResult<T> dot(const T* left, const T* right, std::size_t count) noexcept
+    {
+        return detail::DotResult<T>(detail::DotOf(left, right, count, detail::DotKind<T>()));
+    }
+
+    /**
+     * \brief Overflow safe sum of a SnugInt array
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy, decides a sum that does not fit
+     * @param data array to be summed
+     * @param count number of elements
+     * @return the sum
+     */
+    template<class T, class P>
+    SnugInt<T, P> sum(const SnugInt<T, P>* data, std::size_t count) noexcept(P::nothrow)
+    {
+        return SnugInt<T, P>::Resolve(sum(detail::RawArray(data), count));
+    }
+
+    /**
+     * \brief Overflow safe product of a SnugInt array
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy, decides a product that does not fit
+     * @param data array to be multiplied
+     * @param count number of elements
+     * @return the product
+     */
+    template<class T, class P>
+    SnugInt<T, P> product(const SnugInt<T, P>* data, std::size_t count) noexcept(P::nothrow)
+    {
+        return SnugInt<T, P>::Resolve(product(detail::RawArray(data), count));
+    }
+
+    /**
+     * \brief Overflow safe dot product of two SnugInt arrays
+     *
+     * @tparam T SnugInt integer type
+     * @tparam P SnugInt overflow policy, decides a dot product that does not fit
+     * @param left array to be multiplied with right
+     * @param right array to be multiplied with left
+     * @param count number of elements
+     * @return the dot product
+     */
+    template<class T, class P>
+    SnugInt<T, P> dot(const SnugInt<T, P>* left, const SnugInt<T, P>* right, std::size_t count) noexcept(P::nothrow)
+    {
+        return SnugInt<T, P>::Resolve(dot(detail::RawArray(left), detail::RawArray(right), count));
+    }
+}
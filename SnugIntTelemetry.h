@@ -0,0 +1,308 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGINT_TELEMETRY_H
+#define PROJECT_SNUGINT_TELEMETRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifndef SNUGINT_TELEMETRY
+#define SNUGINT_TELEMETRY 0
+#endif
+
+#if SNUGINT_TELEMETRY
+#include <atomic>
+#include <mutex>
+
+#if !SNUGINT_HAS_CONSTANT_EVALUATED
+#error "SNUGINT_TELEMETRY needs __builtin_is_constant_evaluated or std::is_constant_evaluated to keep SnugInt constexpr"
+#endif
+#endif
+
+/**
+ * \brief Kinds of checked SnugInt operations
+ *
+ * \details
+ * Each kind matches a group of SnugInt exceptions, % counts as Div and abs as Negate
+ */
+enum class SnugIntOperation
+{
+    Add,     /**< SnugInt_Addition_*_Exception */
+    Sub,     /**< SnugInt_Subtraction_*_Exception */
+    Mult,    /**< SnugInt_Multiplication_*_Exception */
+    Div,     /**< SnugInt_Division_*_Exception */
+    Shift,   /**< SnugInt_Shift_*_Exception */
+    Negate,  /**< SnugInt_Negation_*_Exception */
+    Convert  /**< SnugInt_Size_Mismatch_Exception and SnugInt_Type_Mismatch_Exception */
+};
+
+/**
+ * \brief Counts of a SnugIntTelemetry snapshot
+ *
+ * \details
+ * operations holds the checked operations of each SnugIntOperation, errors the failed checks
+ * of each SnugIntError (errors[0], SnugIntError::None, counts the checks that passed)
+ */
+struct SnugIntTelemetrySnapshot
+{
+    static constexpr std::size_t operation_count = 7;
+    static constexpr std::size_t error_count = 18;
+
+    std::uint64_t operations[operation_count];  /**< checked operations by SnugIntOperation */
+    std::uint64_t errors[error_count];          /**< failed checks by SnugIntError */
+
+    std::uint64_t checked(SnugIntOperation operation) const noexcept { return operations[static_cast<std::size_t>(operation)]; };
+    std::uint64_t failed(SnugIntError error) const noexcept { return errors[static_cast<std::size_t>(error)]; };
+
+    std::string prometheus() const;
+};
+
+/**
+ * \brief Overflow telemetry
+ *
+ * \details
+ * With SNUGINT_TELEMETRY defined to 1 every Try method, and so every checked operator whatever the Policy,
+ * counts the operation and its result. Each thread counts into its own cache line with relaxed
+ * loads and stores (a plain increment, no locked instruction), snapshot() sums the live threads and the threads
+ * that already exited. Without SNUGINT_TELEMETRY nothing is counted and snapshot() is all zeros.
+ *
+ * \details
+ * The counters only ever grow, as Prometheus counters expect. Constant expressions are not counted.
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *response << SnugIntTelemetry::snapshot().prometheus();   // in the handler of the metrics endpoint
+ * \endcode
+ */
+class SnugIntTelemetry
+{
+public:
+    static constexpr bool enabled = SNUGINT_TELEMETRY != 0;
+
+    static SnugIntTelemetrySnapshot snapshot();
+};
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief The SnugIntOperation a SnugIntError belongs to
+     */
+    constexpr SnugIntOperation OperationOf(SnugIntError error) noexcept
+    {
+        return error <= SnugIntError::AdditionUnderflow ? SnugIntOperation::Add
+             : error <= SnugIntError::SubtractionUnderflow ? SnugIntOperation::Sub
+             : error <= SnugIntError::MultiplicationUnderflow ? SnugIntOperation::Mult
+             : error <= SnugIntError::TypeMismatch ? SnugIntOperation::Convert
+             : error <= SnugIntError::DivisionUnderflow ? SnugIntOperation::Div
+             : error <= SnugIntError::ShiftUnderflow ? SnugIntOperation::Shift
+             : error <= SnugIntError::NegationUnderflow ? SnugIntOperation::Negate
+             : SnugIntOperation::Convert;
+    }
+
+    static_assert(static_cast<std::size_t>(SnugIntError::InvalidFormat) + 1 == SnugIntTelemetrySnapshot::error_count,
+                  "SnugIntTelemetrySnapshot::error_count must cover every SnugIntError");
+
+    // label values of the Prometheus export, in enum order
+    constexpr const char* OperationNames[] = {"add", "sub", "mult", "div", "shift", "negate", "convert"};
+    constexpr const char* ErrorNames[] = {"none", "addition_overflow", "addition_underflow", "subtraction_overflow",
+                                          "subtraction_underflow", "multiplication_overflow", "multiplication_underflow",
+                                          "size_mismatch", "type_mismatch", "division_by_zero", "division_overflow",
+                                          "division_underflow", "shift_out_of_range", "shift_overflow", "shift_underflow",
+                                          "negation_overflow", "negation_underflow", "invalid_format"};
+
+#if SNUGINT_TELEMETRY
+    /**
+     * \brief Counters of one thread
+     *
+     * \details
+     * Only the owning thread writes, so an increment is a relaxed load and store, snapshot() reads with relaxed loads.
+     * Aligned to a cache line so threads never share one
+     */
+    struct alignas(64) TelemetryCounters
+    {
+        std::atomic<std::uint64_t> operations[SnugIntTelemetrySnapshot::operation_count];
+        std::atomic<std::uint64_t> errors[SnugIntTelemetrySnapshot::error_count];
+        TelemetryCounters* next;
+
+        void AddTo(SnugIntTelemetrySnapshot& total) const noexcept
+        {
+            for (std::size_t i = 0; i < SnugIntTelemetrySnapshot::operation_count; ++i)
+                total.operations[i] += operations[i].load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < SnugIntTelemetrySnapshot::error_count; ++i)
+                total.errors[i] += errors[i].load(std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * \brief The counters of every live thread and the totals of the threads that exited
+     */
+    struct TelemetryRegistry
+    {
+        std::mutex lock;
+        TelemetryCounters* threads = nullptr;
+        SnugIntTelemetrySnapshot retired = {};
+    };
+
+    inline TelemetryRegistry& Registry()
+    {   // never destroyed, a thread may exit after static destruction started
+        static TelemetryRegistry* registry = new TelemetryRegistry();
+        return *registry;
+    }
+
+    inline TelemetryCounters*& LocalCounters() noexcept
+    {   // a trivial thread_local needs no guard on every access
+        static thread_local TelemetryCounters* counters = nullptr;
+        return counters;
+    }
+
+    /**
+     * \brief Links the counters of a thread into the Registry for the lifetime of the thread
+     */
+    struct TelemetryThread
+    {
+        TelemetryCounters counters;
+
+        TelemetryThread() : counters()
+        {
+            TelemetryRegistry& registry = Registry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            counters.next = registry.threads;
+            registry.threads = &counters;
+        }
+
+        ~TelemetryThread()
+        {
+            // operations in later thread_local destructors count into a block nobody reads
+            static thread_local TelemetryCounters discarded;
+            LocalCounters() = &discarded;
+
+            TelemetryRegistry& registry = Registry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            counters.AddTo(registry.retired);
+            TelemetryCounters** link = &registry.threads;
+            while (*link != &counters)
+                link = &(*link)->next;
+            *link = counters.next;
+        }
+    };
+
+    inline TelemetryCounters* AttachTelemetry()
+    {
+        static thread_local TelemetryThread thread;
+        LocalCounters() = &thread.counters;
+        return &thread.counters;
+    }
+
+    inline void Bump(std::atomic<std::uint64_t>& counter) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    inline void Count(SnugIntOperation operation, SnugIntError error)
+    {
+        TelemetryCounters* counters = LocalCounters();
+        if (counters == nullptr)
+            counters = AttachTelemetry();
+
+        Bump(counters->operations[static_cast<std::size_t>(operation)]);
+        Bump(counters->errors[static_cast<std::size_t>(error)]);
+    }
+#endif
+
+    /**
+     * \brief Counts result as an operation of kind operation
+     *
+     * \details
+     * Called by every Try method on its result, compiles to nothing without SNUGINT_TELEMETRY
+     *
+     * @param operation kind of the operation
+     * @param result result of the operation
+     * @return result
+     */
+    template<class Type>
+    constexpr SnugIntResult<Type> Record(SnugIntOperation operation, const SnugIntResult<Type>& result) noexcept
+    {
+#if SNUGINT_TELEMETRY
+        if (!SNUGINT_IS_CONSTANT_EVALUATED())
+            Count(operation, result.error);
+#else
+        static_cast<void>(operation);
+#endif
+        return result;
+    }
+}
+}
+
+/**
+ * \brief Sums the counters of every thread
+ *
+ * \details
+ * Takes a lock shared with thread start and exit, not with the counting itself
+ *
+ * @return the counts since the start of the process, all zeros without SNUGINT_TELEMETRY
+ */
+inline SnugIntTelemetrySnapshot SnugIntTelemetry::snapshot()
+{
+    SnugIntTelemetrySnapshot total = {};
+#if SNUGINT_TELEMETRY
+    snug::detail::TelemetryRegistry& registry = snug::detail::Registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    total = registry.retired;
+    for (const snug::detail::TelemetryCounters* counters = registry.threads; counters != nullptr; counters = counters->next)
+        counters->AddTo(total);
+#endif
+    return total;
+}
+
+/**
+ * \brief Prometheus text exposition of the snapshot
+ *
+ * \details
+ * snugint_checked_operations_total{operation} and snugint_errors_total{operation, error}, both counters
+ *
+ * @return the metrics, one sample per line
+ */
+inline std::string SnugIntTelemetrySnapshot::prometheus() const
+{
+    std::string text = "# HELP snugint_checked_operations_total Checked SnugInt operations.\n"
+                       "# TYPE snugint_checked_operations_total counter\n";
+    for (std::size_t i = 0; i < operation_count; ++i)
+    {
+        text += "snugint_checked_operations_total{operation=\"";
+        text += snug::detail::OperationNames[i];
+        text += "\"} " + std::to_string(operations[i]) + "\n";
+    }
+
+    text += "# HELP snugint_errors_total Failed SnugInt checks.\n"
+            "# TYPE snugint_errors_total counter\n";
+    for (std::size_t i = 1; i < error_count; ++i)
+    {
+        text += "snugint_errors_total{operation=\"";
+        text += snug::detail::OperationNames[static_cast<std::size_t>(snug::detail::OperationOf(static_cast<SnugIntError>(i)))];
+        text += "\",error=\"";
+        text += snug::detail::ErrorNames[i];
+        text += "\"} " + std::to_string(errors[i]) + "\n";
+    }
+
+    return text;
+}
+
+#endif //PROJECT_SNUGINT_TELEMETRY_H
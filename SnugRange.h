@@ -0,0 +1,125 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#ifndef PROJECT_SNUGRANGE_H
+#define PROJECT_SNUGRANGE_H
+
+#include "SnugInt.h"
+
+namespace snug
+{
+namespace detail
+{
+    template<class T, T A, T B, T C, T D> struct RangeAdd;
+    template<class T, T A, T B, T C, T D> struct RangeSub;
+    template<class T, T A, T B, T C, T D> struct RangeMult;
+}
+}
+
+/**
+ * \brief SnugInt with compile time value bounds
+ *
+ * \details
+ * A SnugRange<Type, Min, Max> holds a Type that is known to be in [Min, Max]. The result of +, - and *
+ * is a SnugRange whose bounds are the propagated interval of the operands, so the bounds travel
+ * through an expression in the type system. When the propagated interval fits in Type the operation
+ * can not overflow and compiles to the plain instruction, the check is only kept where the interval
+ * reaches past the limits of Type (the result bounds are then clamped to those limits).
+ *
+ * \details
+ * - Construction from a Type checks the value against [Min, Max] and reports SizeMismatch to the Policy
+ *
+ * \details
+ * - A SnugRange converts without checks to a SnugRange with a wider interval and to SnugInt<Type, Policy>
+ *
+ * \details
+ * - A Policy that keeps the wrapped result (SnugIntWrapPolicy, SnugIntFlagPolicy) has it clamped into the
+ *   bounds of the result, the interval is a guarantee of the type
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugRange<int64_t, 0, 4095> index = column;      // checked once
+ *SnugRange<int64_t, 0, 7> lane = unit;
+ *auto offset = index * snug::range_constant<int64_t, 8>() + lane;  // SnugRange<int64_t, 0, 32767>, no checks
+ * \endcode
+ * @tparam Type integer to do operations with
+ * @tparam Min smallest value the SnugRange can hold
+ * @tparam Max largest value the SnugRange can hold
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+ */
+template<class Type, Type Min, Type Max, class Policy = SnugIntThrowPolicy>
+class SnugRange
+{
+    static_assert(std::is_integral<Type>::value, "SnugRange must be an integral");
+    static_assert(sizeof(Type) <= 8, "SnugRange supports integrals of up to 64 bits");
+    static_assert(Min <= Max, "SnugRange requires Min <= Max");
+public:
+    static constexpr Type min = Min; /**< smallest value of the range */
+    static constexpr Type max = Max; /**< largest value of the range */
+
+    // Constructors
+    constexpr SnugRange() noexcept;
+    constexpr SnugRange(const SnugRange &other) = default;
+    constexpr SnugRange(const Type &item) noexcept(Policy::nothrow);
+    template<Type A, Type B> constexpr SnugRange(const SnugRange<Type, A, B, Policy> &other) noexcept(Policy::nothrow);
+
+    // Assignment Operators
+    SnugRange& operator = (const SnugRange& other) = default;
+
+    // Non throwing Operations
+    static constexpr SnugIntResult<Type> TryFrom(const Type& item) noexcept;
+
+    // Accessor Operators
+    constexpr Type getValue() const noexcept { return value; };
+    constexpr operator SnugInt<Type, Policy>() const noexcept { return SnugInt<Type, Policy>(value); };
+
+    // Mathematical Operators (SnugRange, SnugRange)
+    template<class T, T A, T B, T C, T D, class P>
+    friend constexpr SnugRange<T, snug::detail::RangeAdd<T, A, B, C, D>::min, snug::detail::RangeAdd<T, A, B, C, D>::max, P>
+    operator+(const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept(P::nothrow);
+    template<class T, T A, T B, T C, T D, class P>
+    friend constexpr SnugRange<T, snug::detail::RangeSub<T, A, B, C, D>::min, snug::detail::RangeSub<T, A, B, C, D>::max, P>
+    operator-(const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept(P::nothrow);
+    template<class T, T A, T B, T C, T D, class P>
+    friend constexpr SnugRange<T, snug::detail::RangeMult<T, A, B, C, D>::min, snug::detail::RangeMult<T, A, B, C, D>::max, P>
+    operator*(const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept(P::nothrow);
+
+    // Comparison Operators (SnugRange, SnugRange)
+    template<class T, T A, T B, T C, T D, class P> friend constexpr bool operator< (const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept;
+    template<class T, T A, T B, T C, T D, class P> friend constexpr bool operator> (const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept;
+    template<class T, T A, T B, T C, T D, class P> friend constexpr bool operator==(const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept;
+    template<class T, T A, T B, T C, T D, class P> friend constexpr bool operator!=(const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept;
+    template<class T, T A, T B, T C, T D, class P> friend constexpr bool operator>=(const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept;
+    template<class T, T A, T B, T C, T D, class P> friend constexpr bool operator<=(const SnugRange<T, A, B, P>& left, const SnugRange<T, C, D, P>& right) noexcept;
+private:
+    Type value; /**< stored value in [Min, Max] */
+
+    // Wraps a value that is already known to be in [Min, Max]
+    struct RawTag {};
+    constexpr SnugRange(RawTag, Type item) noexcept : value(item) {};
+
+    static constexpr Type Clamp(Type item) noexcept { return item < Min ? Min : (item > Max ? Max : item); };
+};
+
+namespace snug
+{
+    // A SnugRange holding exactly Value, for constants in SnugRange expressions
+    template<class T, T Value, class P = SnugIntThrowPolicy> constexpr SnugRange<T, Value, Value, P> range_constant() noexcept;
+}
+
+#include "SnugRange.tpp"
+
+#endif //PROJECT_SNUGRANGE_H
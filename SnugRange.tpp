@@ -0,0 +1,343 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include "SnugRange.h"
+
+template<class Type, Type Min, Type Max, class Policy> constexpr Type SnugRange<Type, Min, Max, Policy>::min;
+template<class Type, Type Min, Type Max, class Policy> constexpr Type SnugRange<Type, Min, Max, Policy>::max;
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief Exact less than of two sign magnitude values
+     */
+    constexpr bool ExactLess(Exact left, Exact right) noexcept
+    {
+        if (left.negative != right.negative)
+            return left.negative;
+
+        const bool equal = left.wide == right.wide && left.magnitude == right.magnitude;
+        const bool larger = left.wide != right.wide ? left.wide : left.magnitude > right.magnitude;
+        return left.negative ? larger : !larger && !equal;
+    }
+
+    constexpr Exact ExactMin(Exact left, Exact right) noexcept
+    {
+        return ExactLess(right, left) ? right : left;
+    }
+
+    constexpr Exact ExactMax(Exact left, Exact right) noexcept
+    {
+        return ExactLess(left, right) ? right : left;
+    }
+
+    /**
+     * \brief Closest value of T to item
+     */
+    template<class T>
+    constexpr T ExactClamp(Exact item) noexcept
+    {
+        if (ExactFits<T>(item))
+            return ExactWrap<T>(item);
+        return item.negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    }
+
+    /**
+     * \brief Result bounds of an operation on [A, B] and [C, D]
+     *
+     * \details
+     * Bounds provides the exact Low() and High() of the propagated interval, min and max are
+     * those clamped to T and checked is set when the interval reaches past the limits of T
+     */
+    template<class T, class Bounds>
+    struct RangeOf
+    {
+        static constexpr T min = ExactClamp<T>(Bounds::Low());
+        static constexpr T max = ExactClamp<T>(Bounds::High());
+        static constexpr bool checked = !ExactFits<T>(Bounds::Low()) || !ExactFits<T>(Bounds::High());
+    };
+
+    template<class T, T A, T B, T C, T D>
+    struct RangeAddBounds
+    {   // [A + C, B + D]
+        static constexpr Exact Low() noexcept { return ExactAdd(ExactOf(A), ExactOf(C)); };
+        static constexpr Exact High() noexcept { return ExactAdd(ExactOf(B), ExactOf(D)); };
+    };
+
+    template<class T, T A, T B, T C, T D>
+    struct RangeSubBounds
+    {   // [A - D, B - C]
+        static constexpr Exact Low() noexcept { return ExactAdd(ExactOf(A), ExactNegate(ExactOf(D))); };
+        static constexpr Exact High() noexcept { return ExactAdd(ExactOf(B), ExactNegate(ExactOf(C))); };
+    };
+
+    template<class T, T A, T B, T C, T D>
+    struct RangeMultBounds
+    {   // the extremes are among the products of the bounds
+        static constexpr Exact Low() noexcept
+        {
+            return ExactMin(ExactMin(ExactMult(ExactOf(A), ExactOf(C)), ExactMult(ExactOf(A), ExactOf(D))),
+                            ExactMin(ExactMult(ExactOf(B), ExactOf(C)), ExactMult(ExactOf(B), ExactOf(D))));
+        };
+        static constexpr Exact High() noexcept
+        {
+            return ExactMax(ExactMax(ExactMult(ExactOf(A), ExactOf(C)), ExactMult(ExactOf(A), ExactOf(D))),
+                            ExactMax(ExactMult(ExactOf(B), ExactOf(C)), ExactMult(ExactOf(B), ExactOf(D))));
+        };
+    };
+
+    template<class T, T A, T B, T C, T D> struct RangeAdd : RangeOf<T, RangeAddBounds<T, A, B, C, D>> {};
+    template<class T, T A, T B, T C, T D> struct RangeSub : RangeOf<T, RangeSubBounds<T, A, B, C, D>> {};
+    template<class T, T A, T B, T C, T D> struct RangeMult : RangeOf<T, RangeMultBounds<T, A, B, C, D>> {};
+
+    /**
+     * \brief Range operation kernels
+     *
+     * \details
+     * Apply is the plain operation, only used when the result is proven to fit in T.
+     * Try is the checked operation for intervals that reach past the limits of T.
+     */
+    template<class T>
+    struct RangeAddOp
+    {
+        static constexpr T Apply(T left, T right) noexcept { return static_cast<T>(left + right); };
+        static constexpr SnugIntResult<T> Try(T left, T right) noexcept { return SnugInt<T, SnugIntWrapPolicy>::TryAdd(left, right); };
+    };
+
+    template<class T>
+    struct RangeSubOp
+    {
+        static constexpr T Apply(T left, T right) noexcept { return static_cast<T>(left - right); };
+        static constexpr SnugIntResult<T> Try(T left, T right) noexcept { return SnugInt<T, SnugIntWrapPolicy>::TrySub(left, right); };
+    };
+
+    template<class T>
+    struct RangeMultOp
+    {
+        static constexpr T Apply(T left, T right) noexcept { return static_cast<T>(left * right); };
+        static constexpr SnugIntResult<T> Try(T left, T right) noexcept { return SnugInt<T, SnugIntWrapPolicy>::TryMult(left, right); };
+    };
+
+    /**
+     * \brief Runs Op on values of a proven interval, no check
+     */
+    template<class Op, class T, class P>
+    constexpr T RangeApply(T left, T right, T, T, std::false_type) noexcept
+    {
+        return Op::Apply(left, right);
+    }
+
+    /**
+     * \brief Runs Op on values of an interval reaching past the limits of T
+     *
+     * \details
+     * A failure is handed to the Policy, whatever it returns is clamped to [low, high]
+     */
+    template<class Op, class T, class P>
+    constexpr T RangeApply(T left, T right, T low, T high, std::true_type) noexcept(P::nothrow)
+    {
+        const SnugIntResult<T> result = Op::Try(left, right);
+        if (SNUGINT_LIKELY(result.ok()))
+            return result.value;
+
+        const T item = SnugInt<T, P>::Resolve(result);
+        return item < low ? low : (item > high ? high : item);
+    }
+}
+}
+
+/**
+ * \brief SnugRange default constructor
+ *
+ * \details
+ * Sets value to 0, or to the bound closest to 0 when 0 is not in [Min, Max]
+ */
+template<class Type, Type Min, Type Max, class Policy>
+constexpr SnugRange<Type, Min, Max, Policy>::SnugRange() noexcept
+    : value(Min > 0 ? Min : (Max < 0 ? Max : 0))
+{
+}
+
+/**
+ * \brief SnugRange constructor (Type)
+ *
+ * \details
+ * Checks item against [Min, Max], a value outside is handed to the Policy as SizeMismatch
+ * and saturates to the closest bound
+ *
+ * @param item value to be held
+ */
+template<class Type, Type Min, Type Max, class Policy>
+constexpr SnugRange<Type, Min, Max, Policy>::SnugRange(const Type &item) noexcept(Policy::nothrow)
+    : value(Clamp(SnugInt<Type, Policy>::Resolve(TryFrom(item), item < Min ? Min : Max)))
+{
+}
+
+/**
+ * \brief SnugRange constructor (SnugRange)
+ *
+ * \details
+ * Converts from another interval of Type, the check compiles away when [A, B] lies within [Min, Max]
+ *
+ * @tparam A smallest value of other
+ * @tparam B largest value of other
+ * @param other value to be held
+ */
+template<class Type, Type Min, Type Max, class Policy>
+template<Type A, Type B>
+constexpr SnugRange<Type, Min, Max, Policy>::SnugRange(const SnugRange<Type, A, B, Policy> &other) noexcept(Policy::nothrow)
+    : value((A >= Min && B <= Max) ? other.getValue() : SnugRange(other.getValue()).value)
+{
+}
+
+/**
+ * \brief Checks item against [Min, Max] without throwing
+ *
+ * @param item value to be checked
+ * @return item, or SizeMismatch if it is outside [Min, Max]
+ */
+template<class Type, Type Min, Type Max, class Policy>
+constexpr SnugIntResult<Type> SnugRange<Type, Min, Max, Policy>::TryFrom(const Type &item) noexcept
+{
+    SnugIntResult<Type> result = {item, SnugIntError::None};
+    if (item < Min || item > Max)
+        result.error = SnugIntError::SizeMismatch;
+    return result;
+}
+
+/**
+ * \brief SnugRange addition operator overload (SnugRange, SnugRange)
+ *
+ * \details
+ * The result holds [A + C, B + D] clamped to Type, the overflow check is only kept
+ * when that interval reaches past the limits of Type
+ *
+ * @param left SnugRange to be added
+ * @param right SnugRange to be added
+ * @return sum of left and right
+ */
+template<class T, T A, T B, T C, T D, class P>
+constexpr SnugRange<T, snug::detail::RangeAdd<T, A, B, C, D>::min, snug::detail::RangeAdd<T, A, B, C, D>::max, P>
+operator+(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept(P::nothrow)
+{
+    typedef snug::detail::RangeAdd<T, A, B, C, D> Range;
+    typedef SnugRange<T, Range::min, Range::max, P> Result;
+    return Result(typename Result::RawTag(), snug::detail::RangeApply<snug::detail::RangeAddOp<T>, T, P>(
+            left.value, right.value, Range::min, Range::max, std::integral_constant<bool, Range::checked>()));
+}
+
+/**
+ * \brief SnugRange subtraction operator overload (SnugRange, SnugRange)
+ *
+ * \details
+ * The result holds [A - D, B - C] clamped to Type, the overflow check is only kept
+ * when that interval reaches past the limits of Type
+ *
+ * @param left SnugRange to be subtracted from
+ * @param right SnugRange to be subtracted
+ * @return difference of left and right
+ */
+template<class T, T A, T B, T C, T D, class P>
+constexpr SnugRange<T, snug::detail::RangeSub<T, A, B, C, D>::min, snug::detail::RangeSub<T, A, B, C, D>::max, P>
+operator-(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept(P::nothrow)
+{
+    typedef snug::detail::RangeSub<T, A, B, C, D> Range;
+    typedef SnugRange<T, Range::min, Range::max, P> Result;
+    return Result(typename Result::RawTag(), snug::detail::RangeApply<snug::detail::RangeSubOp<T>, T, P>(
+            left.value, right.value, Range::min, Range::max, std::integral_constant<bool, Range::checked>()));
+}
+
+/**
+ * \brief SnugRange multiplication operator overload (SnugRange, SnugRange)
+ *
+ * \details
+ * The result holds the smallest and largest product of the bounds clamped to Type, the overflow
+ * check is only kept when that interval reaches past the limits of Type
+ *
+ * @param left SnugRange to be multiplied
+ * @param right SnugRange to be multiplied
+ * @return product of left and right
+ */
+template<class T, T A, T B, T C, T D, class P>
+constexpr SnugRange<T, snug::detail::RangeMult<T, A, B, C, D>::min, snug::detail::RangeMult<T, A, B, C, D>::max, P>
+operator*(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept(P::nothrow)
+{
+    typedef snug::detail::RangeMult<T, A, B, C, D> Range;
+    typedef SnugRange<T, Range::min, Range::max, P> Result;
+    return Result(typename Result::RawTag(), snug::detail::RangeApply<snug::detail::RangeMultOp<T>, T, P>(
+            left.value, right.value, Range::min, Range::max, std::integral_constant<bool, Range::checked>()));
+}
+
+/**
+ * \brief SnugRange comparison operator overloads (SnugRange, SnugRange)
+ *
+ * \details
+ * Compare the held values, a comparison of disjoint intervals folds to a constant
+ */
+template<class T, T A, T B, T C, T D, class P>
+constexpr bool operator<(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept
+{
+    return left.value < right.value;
+}
+
+template<class T, T A, T B, T C, T D, class P>
+constexpr bool operator>(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept
+{
+    return left.value > right.value;
+}
+
+template<class T, T A, T B, T C, T D, class P>
+constexpr bool operator==(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept
+{
+    return left.value == right.value;
+}
+
+template<class T, T A, T B, T C, T D, class P>
+constexpr bool operator!=(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept
+{
+    return left.value != right.value;
+}
+
+template<class T, T A, T B, T C, T D, class P>
+constexpr bool operator>=(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept
+{
+    return left.value >= right.value;
+}
+
+template<class T, T A, T B, T C, T D, class P>
+constexpr bool operator<=(const SnugRange<T, A, B, P> &left, const SnugRange<T, C, D, P> &right) noexcept
+{
+    return left.value <= right.value;
+}
+
+namespace snug
+{
+    /**
+     * \brief A SnugRange holding exactly Value
+     *
+     * @tparam T integral type of the constant
+     * @tparam Value the constant
+     * @tparam P SnugInt overflow policy of the expression the constant is used in
+     * @return SnugRange<T, Value, Value, P> holding Value
+     */
+    template<class T, T Value, class P>
+    constexpr SnugRange<T, Value, Value, P> range_constant() noexcept
+    {
+        return SnugRange<T, Value, Value, P>(Value);
+    }
+}
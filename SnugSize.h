@@ -0,0 +1,149 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#ifndef PROJECT_SNUGSIZE_H
+#define PROJECT_SNUGSIZE_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+
+#include "SnugInt.h"
+
+/**
+ * \brief SnugInt holding a size or an index, the type the helpers below return through a Policy
+ */
+template<class Policy = SnugIntThrowPolicy>
+using BasicSnugSize = SnugInt<std::size_t, Policy>;
+
+typedef BasicSnugSize<> SnugSize;
+
+/**
+ * \brief Checked size and index arithmetic
+ *
+ * \details
+ * Sizing an allocation is a product and a sum, count * sizeof(T) + header, and both can wrap. The
+ * helpers below fuse the two checks: the product goes through the checked multiplication of the backend
+ * and the sum through the checked addition, with the builtin backend a mul + jo followed by an add + jc,
+ * without a SnugInt temporary in between.
+ *
+ * \details
+ * - try_alloc_size and try_index report MultiplicationOverflow or AdditionOverflow (MultiplicationUnderflow
+ *   for a negative count), try_index with a limit also reports SizeMismatch for an index not below it
+ *
+ * \details
+ * - checked_alloc_size, checked_array_size and checked_index hand a failure to the Policy and return a plain
+ *   std::size_t, which goes straight into resize, reserve or an allocator. A saturating Policy yields
+ *   SIZE_MAX for every failure, a negative count included, a size no allocation succeeds with
+ *
+ * \details
+ * - Any integral count is accepted, a negative one fails instead of turning into a huge size_t
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *buffer.resize(snug::checked_alloc_size(count, sizeof(Record), sizeof(Header)));  // throws on overflow
+ *std::size_t cell = snug::checked_index(row, columns, column, cells.size());     // throws past the end
+ * \endcode
+ */
+namespace snug
+{
+    // Fused count * size + extra
+    template<class Count> constexpr SnugIntResult<std::size_t> try_alloc_size(Count count, std::size_t size, std::size_t extra = 0) noexcept;
+    template<class Policy = SnugIntThrowPolicy, class Count>
+    constexpr std::size_t checked_alloc_size(Count count, std::size_t size, std::size_t extra = 0) noexcept(Policy::nothrow);
+    template<class T, class Policy = SnugIntThrowPolicy, class Count>
+    constexpr std::size_t checked_array_size(Count count, std::size_t extra = 0) noexcept(Policy::nothrow);
+
+    // Fused row * stride + column, optionally checked against the element count
+    template<class Row> constexpr SnugIntResult<std::size_t> try_index(Row row, std::size_t stride, std::size_t column) noexcept;
+    template<class Row> constexpr SnugIntResult<std::size_t> try_index(Row row, std::size_t stride, std::size_t column, std::size_t limit) noexcept;
+    template<class Policy = SnugIntThrowPolicy, class Row>
+    constexpr std::size_t checked_index(Row row, std::size_t stride, std::size_t column) noexcept(Policy::nothrow);
+    template<class Policy = SnugIntThrowPolicy, class Row>
+    constexpr std::size_t checked_index(Row row, std::size_t stride, std::size_t column, std::size_t limit) noexcept(Policy::nothrow);
+}
+
+/**
+ * \brief Allocator adaptor that checks the byte size of every allocation
+ *
+ * \details
+ * allocate(n) computes n * sizeof(T) with try_alloc_size before anything else, a size that wraps never
+ * reaches Base and so never reaches operator new. The check is a mul + jo on the hot path, the failure
+ * is an out of line cold call, so a container growing through a SnugAllocator pays no exception setup
+ * per allocation.
+ *
+ * \details
+ * - A failed size is handed to the Policy, SnugIntThrowPolicy throws SnugInt_Multiplication_Overflow_Exception.
+ *   An allocation can not return without memory, so when the Policy returns std::bad_array_new_length is thrown
+ *
+ * \details
+ * - Everything else, including deallocate and equality, is forwarded to Base
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *std::vector<Record, SnugAllocator<Record>> records;
+ *records.resize(count);    // SnugInt_Multiplication_Overflow_Exception instead of a wrapped size
+ * \endcode
+ * @tparam T element type
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+ * @tparam Base allocator that does the allocation
+ */
+template<class T, class Policy = SnugIntThrowPolicy, class Base = std::allocator<T>>
+class SnugAllocator
+{
+    typedef std::allocator_traits<Base> Traits;
+public:
+    typedef T value_type;
+    typedef typename Traits::size_type size_type;
+    typedef typename Traits::difference_type difference_type;
+    typedef typename Traits::propagate_on_container_copy_assignment propagate_on_container_copy_assignment;
+    typedef typename Traits::propagate_on_container_move_assignment propagate_on_container_move_assignment;
+    typedef typename Traits::propagate_on_container_swap propagate_on_container_swap;
+
+    template<class U>
+    struct rebind
+    {
+        typedef SnugAllocator<U, Policy, typename Traits::template rebind_alloc<U>> other;
+    };
+
+    // Constructors
+    SnugAllocator() = default;
+    SnugAllocator(const Base& item) noexcept : base(item) {}
+    template<class U, class B>
+    SnugAllocator(const SnugAllocator<U, Policy, B>& other) noexcept : base(other.getBase()) {}
+
+    // Allocation
+    T* allocate(std::size_t count);
+    void deallocate(T* pointer, std::size_t count) noexcept { Traits::deallocate(base, pointer, count); }
+    std::size_t max_size() const noexcept { return Traits::max_size(base); }
+
+    // Accessor Operators
+    const Base& getBase() const noexcept { return base; }
+
+    // Comparison Operators
+    template<class U, class B>
+    bool operator == (const SnugAllocator<U, Policy, B>& other) const noexcept { return base == other.getBase(); }
+    template<class U, class B>
+    bool operator != (const SnugAllocator<U, Policy, B>& other) const noexcept { return !(base == other.getBase()); }
+private:
+    Base base; /**< allocator doing the allocations */
+};
+
+#include "SnugSize.tpp"
+
+#endif //PROJECT_SNUGSIZE_H
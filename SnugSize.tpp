@@ -0,0 +1,176 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include "SnugSize.h"
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief Failure path of SnugAllocator::allocate, out of line and cold
+     *
+     * \details
+     * The Policy sees the error in SNUGINT_MODE_CHECKED, then std::bad_array_new_length is thrown in every
+     * mode (std::abort without exceptions), a wrapped size is never allocated
+     *
+     * @tparam Policy Policy of the SnugAllocator
+     * @param bytes the failed byte size
+     */
+    template<class Policy>
+    [[noreturn]] SNUGINT_COLD void RejectAllocation(const SnugIntResult<std::size_t>& bytes)
+    {
+#if SNUGINT_MODE == SNUGINT_MODE_CHECKED
+        SnugInt<std::size_t, Policy>::Resolve(bytes, std::numeric_limits<std::size_t>::max());
+#else
+        static_cast<void>(bytes);
+#endif
+#if SNUGINT_HAS_EXCEPTIONS
+        throw std::bad_array_new_length();
+#else
+        std::abort();
+#endif
+    }
+}
+
+    /**
+     * \brief Checked count * size + extra
+     *
+     * \details
+     * The value of a failed result is the wrapped count * size + extra
+     *
+     * @tparam Count integral type of count
+     * @param count number of elements
+     * @param size size of one element in bytes
+     * @param extra bytes added after the product, e.g. a header
+     * @return the size, or MultiplicationOverflow / MultiplicationUnderflow / AdditionOverflow
+     */
+    template<class Count>
+    constexpr SnugIntResult<std::size_t> try_alloc_size(Count count, std::size_t size, std::size_t extra) noexcept
+    {
+        static_assert(detail::IsInteger<Count>::value, "an allocation count must be an integral");
+        SnugIntResult<std::size_t> result = {0, SnugIntError::None};
+        std::size_t product = 0;
+
+        if (detail::MixedMultOverflow(count, size, &product))
+        {
+            result.value = product + extra;
+            result.error = detail::IsNegative(count) ? SnugIntError::MultiplicationUnderflow : SnugIntError::MultiplicationOverflow;
+        } else if (detail::AddOverflow(product, extra, &result.value))
+            result.error = SnugIntError::AdditionOverflow;
+
+        return detail::Record(SnugIntOperation::Mult, result);
+    }
+
+    /**
+     * \brief count * size + extra, a failure is handed to Policy
+     *
+     * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+     * @tparam Count integral type of count
+     * @param count number of elements
+     * @param size size of one element in bytes
+     * @param extra bytes added after the product
+     * @return the size, or whatever Policy decides for a failed one (SIZE_MAX when saturating)
+     */
+    template<class Policy, class Count>
+    constexpr std::size_t checked_alloc_size(Count count, std::size_t size, std::size_t extra) noexcept(Policy::nothrow)
+    {
+        return SnugInt<std::size_t, Policy>::Resolve(try_alloc_size(count, size, extra), std::numeric_limits<std::size_t>::max());
+    }
+
+    /**
+     * \brief count * sizeof(T) + extra, a failure is handed to Policy
+     *
+     * @tparam T element type
+     * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+     * @tparam Count integral type of count
+     * @param count number of elements
+     * @param extra bytes added after the array
+     * @return the size in bytes, or whatever Policy decides for a failed one
+     */
+    template<class T, class Policy, class Count>
+    constexpr std::size_t checked_array_size(Count count, std::size_t extra) noexcept(Policy::nothrow)
+    {
+        return checked_alloc_size<Policy>(count, sizeof(T), extra);
+    }
+
+    /**
+     * \brief Checked row * stride + column
+     *
+     * @tparam Row integral type of row
+     * @param row index of the row
+     * @param stride elements per row
+     * @param column index in the row
+     * @return the flat index, or MultiplicationOverflow / MultiplicationUnderflow / AdditionOverflow
+     */
+    template<class Row>
+    constexpr SnugIntResult<std::size_t> try_index(Row row, std::size_t stride, std::size_t column) noexcept
+    {
+        return try_alloc_size(row, stride, column);
+    }
+
+    /**
+     * \brief Checked row * stride + column that also has to be below limit
+     *
+     * @tparam Row integral type of row
+     * @param row index of the row
+     * @param stride elements per row
+     * @param column index in the row
+     * @param limit number of elements, e.g. the size of the container
+     * @return the flat index, the errors of try_index, or SizeMismatch when it is not below limit
+     */
+    template<class Row>
+    constexpr SnugIntResult<std::size_t> try_index(Row row, std::size_t stride, std::size_t column, std::size_t limit) noexcept
+    {
+        SnugIntResult<std::size_t> result = try_index(row, stride, column);
+        if (result.ok() && result.value >= limit)
+            result.error = SnugIntError::SizeMismatch;
+        return result;
+    }
+
+    /**
+     * \brief row * stride + column, a failure is handed to Policy
+     */
+    template<class Policy, class Row>
+    constexpr std::size_t checked_index(Row row, std::size_t stride, std::size_t column) noexcept(Policy::nothrow)
+    {
+        return SnugInt<std::size_t, Policy>::Resolve(try_index(row, stride, column), std::numeric_limits<std::size_t>::max());
+    }
+
+    /**
+     * \brief row * stride + column below limit, a failure is handed to Policy
+     */
+    template<class Policy, class Row>
+    constexpr std::size_t checked_index(Row row, std::size_t stride, std::size_t column, std::size_t limit) noexcept(Policy::nothrow)
+    {
+        return SnugInt<std::size_t, Policy>::Resolve(try_index(row, stride, column, limit), std::numeric_limits<std::size_t>::max());
+    }
+}
+
+/**
+ * \brief Allocates count elements after checking count * sizeof(T)
+ *
+ * @param count number of elements
+ * @return memory for count elements from Base
+ */
+template<class T, class Policy, class Base>
+T* SnugAllocator<T, Policy, Base>::allocate(std::size_t count)
+{
+    const SnugIntResult<std::size_t> bytes = snug::try_alloc_size(count, sizeof(T));
+    if (SNUGINT_UNLIKELY(!bytes.ok()))
+        snug::detail::RejectAllocation<Policy>(bytes);
+    return Traits::allocate(base, count);
+}
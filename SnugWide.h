@@ -0,0 +1,168 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+
+#ifndef PROJECT_SNUGWIDE_H
+#define PROJECT_SNUGWIDE_H
+
+#include <cstddef>
+#include <ostream>
+
+#include "SnugInt.h"
+
+// _addcarry_u64 / _subborrow_u64 for the limb chains on x86-64
+#ifndef SNUGINT_WIDE_INTRINSICS
+#if defined(__x86_64__) || defined(_M_X64)
+#define SNUGINT_WIDE_INTRINSICS 1
+#else
+#define SNUGINT_WIDE_INTRINSICS 0
+#endif
+#endif
+
+#if SNUGINT_WIDE_INTRINSICS
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief true if every T converts exactly into a Bits bit SnugWide, only an unsigned __int128 in 128 bits does not
+     */
+    template<class T, std::size_t Bits>
+    struct WideExact : std::integral_constant<bool, IsInteger<T>::value && (Bits > 128 || sizeof(T) < 16 || IsSigned<T>::value)> {};
+}
+}
+
+/**
+ * \brief Checked signed integer of Bits bits
+ *
+ * \details
+ * A SnugWide<Bits> is a two's complement integer of Bits / 64 limbs of 64 bits, lowest first, for sums and
+ * products that outgrow 64 and 128 bits (a 256 bit accumulator of 128 bit amounts). Addition and subtraction
+ * are one add with carry (adc) or subtract with borrow (sbb) chain over the limbs, multiplication is a
+ * schoolbook chain of 64 x 64 -> 128 bit products (mul, or mulx with BMI2) on the magnitudes that stops at
+ * Bits. Every operation is checked and a failure is handed to Policy as in SnugInt, saturating to min() or max().
+ *
+ * \details
+ * - Integrals (the 128 bit ones included) and SnugInts convert implicitly and exactly, on either side of
+ *   an operator. The one exception is an unsigned __int128 into SnugWide<128>, that conversion is explicit and
+ *   checked, 2^127 and above are SizeMismatch (TryFrom reports it). TryTo and to narrow back, a value that
+ *   does not fit is SizeMismatch
+ *
+ * \details
+ * - Only +, -, *, negation and comparisons are provided, there is no division. Output is decimal through
+ *   snug::to_chars
+ *
+ * \details
+ * - constexpr where SNUGINT_IS_CONSTANT_EVALUATED is available, the carry intrinsics are not
+ *
+ * \section <b>Example Usage:</b>
+ * \code
+ *SnugWide<256> exposure = 0;
+ *for (const Trade& trade : trades)
+ *    exposure += SnugWide<256>(trade.quantity) * trade.price;  // throws past 2^255
+ *std::cout << exposure;
+ * \endcode
+ * @tparam Bits width, a multiple of 64 and at least 128
+ * @tparam Policy what happens on overflow, one of the policies in SnugIntPolicy.h
+ */
+template<std::size_t Bits, class Policy = SnugIntThrowPolicy>
+class SnugWide
+{
+    static_assert(Bits >= 128 && Bits % 64 == 0, "SnugWide must be a multiple of 64 bits, at least 128");
+public:
+    static constexpr std::size_t limbs = Bits / 64;                      /**< number of 64 bit limbs */
+    static constexpr std::size_t max_chars = Bits * 30103 / 100000 + 2;  /**< longest decimal text, sign included */
+
+    // Constructors
+    constexpr SnugWide() noexcept : limb{} {}
+    template<class T, class = typename std::enable_if<snug::detail::WideExact<T, Bits>::value>::type>
+    constexpr SnugWide(T item) noexcept;
+    template<class T, class = typename std::enable_if<snug::detail::IsInteger<T>::value && !snug::detail::WideExact<T, Bits>::value>::type, class = void>
+    constexpr explicit SnugWide(T item) noexcept(Policy::nothrow) : SnugWide(Resolve(TryFrom(item))) {}
+    template<class T, class P, class = typename std::enable_if<snug::detail::WideExact<T, Bits>::value>::type>
+    constexpr SnugWide(const SnugInt<T, P>& item) noexcept : SnugWide(item.getValue()) {}
+    template<class T, class P, class = typename std::enable_if<!snug::detail::WideExact<T, Bits>::value>::type, class = void>
+    constexpr explicit SnugWide(const SnugInt<T, P>& item) noexcept(Policy::nothrow) : SnugWide(item.getValue()) {}
+
+    // Limits
+    static constexpr SnugWide min() noexcept;
+    static constexpr SnugWide max() noexcept;
+
+    // Accessor Operators
+    constexpr unsigned long long getLimb(std::size_t index) const noexcept { return limb[index]; }
+    constexpr bool isNegative() const noexcept { return (limb[limbs - 1] >> 63) != 0; }
+
+    // Narrowing, TryTo reports SizeMismatch, to hands it to Policy and the cast truncates
+    template<class T> constexpr SnugIntResult<T> TryTo() const noexcept;
+    template<class T> constexpr T to() const noexcept(Policy::nothrow);
+    template<class T, class = typename std::enable_if<snug::detail::IsInteger<T>::value>::type>
+    constexpr explicit operator T() const noexcept;
+
+    // Non throwing Operations
+    template<class T> static constexpr SnugIntResult<SnugWide> TryFrom(T item) noexcept;
+    static constexpr SnugIntResult<SnugWide> TryAdd(const SnugWide& left, const SnugWide& right) noexcept;
+    static constexpr SnugIntResult<SnugWide> TrySub(const SnugWide& left, const SnugWide& right) noexcept;
+    static constexpr SnugIntResult<SnugWide> TryMult(const SnugWide& left, const SnugWide& right) noexcept;
+    static constexpr SnugIntResult<SnugWide> TryNegate(const SnugWide& item) noexcept;
+    static constexpr int Compare(const SnugWide& left, const SnugWide& right) noexcept;
+
+    // Hands a failed result to the Policy
+    static constexpr SnugWide Resolve(const SnugIntResult<SnugWide>& result) noexcept(Policy::nothrow);
+
+    // Assignment Operators
+    constexpr SnugWide& operator += (const SnugWide& other) noexcept(Policy::nothrow) { return *this = Resolve(TryAdd(*this, other)); }
+    constexpr SnugWide& operator -= (const SnugWide& other) noexcept(Policy::nothrow) { return *this = Resolve(TrySub(*this, other)); }
+    constexpr SnugWide& operator *= (const SnugWide& other) noexcept(Policy::nothrow) { return *this = Resolve(TryMult(*this, other)); }
+
+    // Mathematical Operators, found through the SnugWide operand so the other side converts
+    friend constexpr SnugWide operator + (const SnugWide& left, const SnugWide& right) noexcept(Policy::nothrow) { return Resolve(TryAdd(left, right)); }
+    friend constexpr SnugWide operator - (const SnugWide& left, const SnugWide& right) noexcept(Policy::nothrow) { return Resolve(TrySub(left, right)); }
+    friend constexpr SnugWide operator * (const SnugWide& left, const SnugWide& right) noexcept(Policy::nothrow) { return Resolve(TryMult(left, right)); }
+    friend constexpr SnugWide operator - (const SnugWide& item) noexcept(Policy::nothrow) { return Resolve(TryNegate(item)); }
+
+    // Comparison Operators
+    friend constexpr bool operator == (const SnugWide& left, const SnugWide& right) noexcept { return Compare(left, right) == 0; }
+    friend constexpr bool operator != (const SnugWide& left, const SnugWide& right) noexcept { return Compare(left, right) != 0; }
+    friend constexpr bool operator < (const SnugWide& left, const SnugWide& right) noexcept { return Compare(left, right) < 0; }
+    friend constexpr bool operator > (const SnugWide& left, const SnugWide& right) noexcept { return Compare(left, right) > 0; }
+    friend constexpr bool operator <= (const SnugWide& left, const SnugWide& right) noexcept { return Compare(left, right) <= 0; }
+    friend constexpr bool operator >= (const SnugWide& left, const SnugWide& right) noexcept { return Compare(left, right) >= 0; }
+private:
+    static constexpr SnugWide Negated(const SnugWide& item) noexcept;
+    template<class T> constexpr void Assign(T item) noexcept;
+
+    unsigned long long limb[Bits / 64]; /**< two's complement value, lowest limb first */
+};
+
+namespace snug
+{
+    template<std::size_t Bits, class P>
+    ToCharsResult to_chars(char* first, char* last, const SnugWide<Bits, P>& value) noexcept;
+}
+
+template<std::size_t Bits, class P> std::ostream& operator<<(std::ostream& os, const SnugWide<Bits, P>& data);
+
+#include "SnugWide.tpp"
+
+#endif //PROJECT_SNUGWIDE_H
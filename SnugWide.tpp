@@ -0,0 +1,541 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+
+#include "SnugWide.h"
+
+template<std::size_t Bits, class Policy> constexpr std::size_t SnugWide<Bits, Policy>::limbs;
+template<std::size_t Bits, class Policy> constexpr std::size_t SnugWide<Bits, Policy>::max_chars;
+
+namespace snug
+{
+namespace detail
+{
+    /**
+     * \brief One step of an add with carry chain, sum = left + right + carry
+     *
+     * @return the carry out of the step
+     */
+    constexpr unsigned char AddCarry(unsigned char carry, unsigned long long left, unsigned long long right,
+                                     unsigned long long* sum) noexcept
+    {
+#if SNUGINT_WIDE_INTRINSICS
+        if (!SNUGINT_IS_CONSTANT_EVALUATED())
+            return _addcarry_u64(carry, left, right, sum);
+#endif
+        const unsigned long long partial = left + right;
+        *sum = partial + carry;
+        return static_cast<unsigned char>((partial < left) | (*sum < partial));
+    }
+
+    /**
+     * \brief One step of a subtract with borrow chain, difference = left - right - borrow
+     *
+     * @return the borrow out of the step
+     */
+    constexpr unsigned char SubBorrow(unsigned char borrow, unsigned long long left, unsigned long long right,
+                                      unsigned long long* difference) noexcept
+    {
+#if SNUGINT_WIDE_INTRINSICS
+        if (!SNUGINT_IS_CONSTANT_EVALUATED())
+            return _subborrow_u64(borrow, left, right, difference);
+#endif
+        const unsigned long long partial = left - right;
+        *difference = partial - borrow;
+        return static_cast<unsigned char>((left < right) | (partial < borrow));
+    }
+
+    /**
+     * \brief One step of a multiplication chain, left * right + addend + carry
+     *
+     * \details
+     * The result always fits in 128 bits, its high half is the next carry
+     *
+     * @param carry carry in, receives the carry out
+     * @return the low 64 bits
+     */
+    constexpr unsigned long long MulAdd(unsigned long long left, unsigned long long right, unsigned long long addend,
+                                        unsigned long long* carry) noexcept
+    {
+#if SNUGINT_HAS_INT128
+        const unsigned __int128 product = static_cast<unsigned __int128>(left) * right + addend + *carry;
+        *carry = static_cast<unsigned long long>(product >> 64);
+        return static_cast<unsigned long long>(product);
+#else
+        unsigned long long high = 0;
+        unsigned long long low = 0;
+#if SNUGINT_WIDE_INTRINSICS && defined(_MSC_VER)
+        if (!SNUGINT_IS_CONSTANT_EVALUATED())
+            low = _umul128(left, right, &high);
+        else
+#endif
+        {   // four 32 x 32 bit products
+            const unsigned long long mask = 0xFFFFFFFFu;
+            const unsigned long long lowest = (left & mask) * (right & mask);
+            const unsigned long long cross = (left >> 32) * (right & mask) + (lowest >> 32);
+            const unsigned long long middle = (left & mask) * (right >> 32) + (cross & mask);
+            high = (left >> 32) * (right >> 32) + (cross >> 32) + (middle >> 32);
+            low = (middle << 32) | (lowest & mask);
+        }
+        low += addend;
+        high += low < addend;
+        low += *carry;
+        high += low < *carry;
+        *carry = high;
+        return low;
+#endif
+    }
+
+    /**
+     * \brief Divides high:low by divisor, high must be below divisor
+     *
+     * @param remainder receives the remainder
+     * @return the quotient
+     */
+    constexpr unsigned long long DivStep(unsigned long long high, unsigned long long low, unsigned long long divisor,
+                                         unsigned long long* remainder) noexcept
+    {
+#if SNUGINT_HAS_INT128
+        const unsigned __int128 numerator = (static_cast<unsigned __int128>(high) << 64) | low;
+        *remainder = static_cast<unsigned long long>(numerator % divisor);
+        return static_cast<unsigned long long>(numerator / divisor);
+#else
+        unsigned long long quotient = 0;
+        for (int bit = 63; bit >= 0; --bit)
+        {   // shift in one bit of low at a time
+            const bool carry = (high >> 63) != 0;
+            high = (high << 1) | ((low >> bit) & 1u);
+            quotient <<= 1;
+            if (carry || high >= divisor)
+            {
+                high -= divisor;
+                quotient |= 1u;
+            }
+        }
+        *remainder = high;
+        return quotient;
+#endif
+    }
+
+    /**
+     * \brief Second limb of a SnugWide holding item
+     */
+    template<class T>
+    constexpr unsigned long long WideHigh(T item, std::false_type) noexcept
+    {
+        return IsNegative(item) ? ~0ull : 0ull;
+    }
+
+    template<class T>
+    constexpr unsigned long long WideHigh(T item, std::true_type) noexcept
+    {
+        return static_cast<unsigned long long>(item >> 64);
+    }
+
+    /**
+     * \brief The low limbs of a SnugWide as T, truncated
+     */
+    template<class T>
+    constexpr T WideLow(unsigned long long low, unsigned long long, std::false_type) noexcept
+    {
+        return static_cast<T>(low);
+    }
+
+    template<class T>
+    constexpr T WideLow(unsigned long long low, unsigned long long high, std::true_type) noexcept
+    {
+        return static_cast<T>((static_cast<typename MakeUnsigned<T>::type>(high) << 64) | low);
+    }
+}
+}
+
+/**
+ * \brief SnugWide constructor (T)
+ *
+ * \details
+ * Every T this constructor takes fits, see WideExact
+ *
+ * @tparam T integral type of item
+ * @param item value to hold
+ */
+template<std::size_t Bits, class Policy>
+template<class T, class>
+constexpr SnugWide<Bits, Policy>::SnugWide(T item) noexcept : limb{}
+{
+    Assign(item);
+}
+
+/**
+ * \brief Converts an integral without throwing
+ *
+ * \details
+ * Only an unsigned __int128 of 2^127 or more fails, in a SnugWide<128>
+ *
+ * @tparam T integral type of item
+ * @param item value to convert
+ * @return item, or SizeMismatch and item reinterpreted as negative
+ */
+template<std::size_t Bits, class Policy>
+template<class T>
+constexpr SnugIntResult<SnugWide<Bits, Policy>> SnugWide<Bits, Policy>::TryFrom(T item) noexcept
+{
+    static_assert(snug::detail::IsInteger<T>::value, "SnugWide converts integrals");
+    SnugIntResult<SnugWide> result = {SnugWide(), SnugIntError::None};
+    result.value.Assign(item);
+    if (!snug::detail::WideExact<T, Bits>::value && result.value.isNegative())
+        result.error = SnugIntError::SizeMismatch;
+    return result;
+}
+
+/**
+ * \brief Sign extends item into the limbs, an unsigned __int128 fills the two limbs of a SnugWide<128>
+ */
+template<std::size_t Bits, class Policy>
+template<class T>
+constexpr void SnugWide<Bits, Policy>::Assign(T item) noexcept
+{
+    const unsigned long long extension = snug::detail::IsNegative(item) ? ~0ull : 0ull;
+    limb[0] = static_cast<unsigned long long>(item);
+    limb[1] = snug::detail::WideHigh(item, std::integral_constant<bool, (sizeof(T) > 8)>());
+    for (std::size_t i = 2; i < limbs; ++i)
+        limb[i] = extension;
+}
+
+/**
+ * \brief Smallest value, -2^(Bits - 1)
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugWide<Bits, Policy> SnugWide<Bits, Policy>::min() noexcept
+{
+    SnugWide result;
+    result.limb[limbs - 1] = 1ull << 63;
+    return result;
+}
+
+/**
+ * \brief Largest value, 2^(Bits - 1) - 1
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugWide<Bits, Policy> SnugWide<Bits, Policy>::max() noexcept
+{
+    SnugWide result;
+    for (std::size_t i = 0; i < limbs; ++i)
+        result.limb[i] = ~0ull;
+    result.limb[limbs - 1] >>= 1;
+    return result;
+}
+
+/**
+ * \brief Converts to T without throwing
+ *
+ * \details
+ * The limbs above the width of T must be the sign extension of the ones below
+ *
+ * @tparam T integral to convert to
+ * @return the value as T, or SizeMismatch and the truncated value when it does not fit
+ */
+template<std::size_t Bits, class Policy>
+template<class T>
+constexpr SnugIntResult<T> SnugWide<Bits, Policy>::TryTo() const noexcept
+{
+    static_assert(snug::detail::IsInteger<T>::value, "SnugWide converts to integrals only");
+    typedef typename std::conditional<(sizeof(T) > 8), T,
+            typename std::conditional<snug::detail::IsSigned<T>::value, long long, unsigned long long>::type>::type Wide;
+    constexpr std::size_t used = sizeof(Wide) / 8;
+
+    const unsigned long long extension = snug::detail::IsSigned<Wide>::value && (limb[used - 1] >> 63) != 0 ? ~0ull : 0ull;
+    bool fits = snug::detail::IsSigned<Wide>::value || !isNegative();
+    for (std::size_t i = used; i < limbs; ++i)
+        fits &= limb[i] == extension;
+
+    const Wide wide = static_cast<Wide>(*this);
+    SnugIntResult<T> result = {static_cast<T>(wide), SnugIntError::None};
+    if (!fits || !snug::detail::Fits<T>(wide))
+        result.error = SnugIntError::SizeMismatch;
+    return snug::detail::Record(SnugIntOperation::Convert, result);
+}
+
+/**
+ * \brief Converts to T
+ *
+ * \details
+ * a <b>SNUGINT_SIZE_EXCEPTION</b> will be thrown if the value does not fit in T, a saturating
+ * Policy returns the bound of T on the side of the value
+ *
+ * @tparam T integral to convert to
+ * @return the value as T
+ */
+template<std::size_t Bits, class Policy>
+template<class T>
+constexpr T SnugWide<Bits, Policy>::to() const noexcept(Policy::nothrow)
+{
+    return SnugInt<T, Policy>::Resolve(TryTo<T>(), isNegative() ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max());
+}
+
+/**
+ * \brief Truncating conversion to T, like a cast of a wider integral
+ */
+template<std::size_t Bits, class Policy>
+template<class T, class>
+constexpr SnugWide<Bits, Policy>::operator T() const noexcept
+{
+    return snug::detail::WideLow<T>(limb[0], limb[1], std::integral_constant<bool, (sizeof(T) > 8)>());
+}
+
+/**
+ * \brief Adds two SnugWides without throwing
+ *
+ * \details
+ * One add with carry chain, the sum overflowed when both operands have the same sign and the sum does not
+ *
+ * @param left value to be added to right
+ * @param right value to be added to left
+ * @return the sum, or AdditionOverflow / AdditionUnderflow with the wrapped sum
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugIntResult<SnugWide<Bits, Policy>> SnugWide<Bits, Policy>::TryAdd(const SnugWide& left, const SnugWide& right) noexcept
+{
+    SnugIntResult<SnugWide> result = {SnugWide(), SnugIntError::None};
+    unsigned char carry = 0;
+    for (std::size_t i = 0; i < limbs; ++i)
+        carry = snug::detail::AddCarry(carry, left.limb[i], right.limb[i], &result.value.limb[i]);
+
+    if (left.isNegative() == right.isNegative() && result.value.isNegative() != left.isNegative())
+        result.error = left.isNegative() ? SnugIntError::AdditionUnderflow : SnugIntError::AdditionOverflow;
+    return snug::detail::Record(SnugIntOperation::Add, result);
+}
+
+/**
+ * \brief Subtracts two SnugWides without throwing
+ *
+ * \details
+ * One subtract with borrow chain, the difference overflowed when the operands have different signs and
+ * the difference does not have the sign of left
+ *
+ * @param left value to be subtracted from
+ * @param right value to subtract
+ * @return the difference, or SubtractionOverflow / SubtractionUnderflow with the wrapped difference
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugIntResult<SnugWide<Bits, Policy>> SnugWide<Bits, Policy>::TrySub(const SnugWide& left, const SnugWide& right) noexcept
+{
+    SnugIntResult<SnugWide> result = {SnugWide(), SnugIntError::None};
+    unsigned char borrow = 0;
+    for (std::size_t i = 0; i < limbs; ++i)
+        borrow = snug::detail::SubBorrow(borrow, left.limb[i], right.limb[i], &result.value.limb[i]);
+
+    if (left.isNegative() != right.isNegative() && result.value.isNegative() != left.isNegative())
+        result.error = left.isNegative() ? SnugIntError::SubtractionUnderflow : SnugIntError::SubtractionOverflow;
+    return snug::detail::Record(SnugIntOperation::Sub, result);
+}
+
+/**
+ * \brief Multiplies two SnugWides without throwing
+ *
+ * \details
+ * Multiplies the magnitudes limb by limb, every row stops at Bits. A product limb past Bits, a carry out of
+ * the top limb or a magnitude of 2^(Bits - 1) or more (exactly 2^(Bits - 1) is min for a negative product)
+ * is an overflow. The wrapped product is the low Bits of the exact one, as for the raw integrals
+ *
+ * @param left value to be multiplied
+ * @param right value to be multiplied
+ * @return the product, or MultiplicationOverflow / MultiplicationUnderflow with the wrapped product
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugIntResult<SnugWide<Bits, Policy>> SnugWide<Bits, Policy>::TryMult(const SnugWide& left, const SnugWide& right) noexcept
+{
+    const bool negative = left.isNegative() != right.isNegative();
+    const SnugWide first = left.isNegative() ? Negated(left) : left;    // min is its own wrapped negation
+    const SnugWide second = right.isNegative() ? Negated(right) : right;
+
+    SnugWide product;
+    bool wide = false;
+    for (std::size_t i = 0; i < limbs; ++i)
+    {
+        if (first.limb[i] == 0)
+            continue;
+
+        unsigned long long carry = 0;
+        for (std::size_t j = 0; i + j < limbs; ++j)
+            product.limb[i + j] = snug::detail::MulAdd(first.limb[i], second.limb[j], product.limb[i + j], &carry);
+
+        wide |= carry != 0;
+        for (std::size_t j = limbs - i; j < limbs; ++j)
+            wide |= second.limb[j] != 0;
+    }
+
+    const bool fits = !wide && (!product.isNegative() || (negative && product == min()));
+    SnugIntResult<SnugWide> result = {negative ? Negated(product) : product, SnugIntError::None};
+    if (!fits)
+        result.error = negative ? SnugIntError::MultiplicationUnderflow : SnugIntError::MultiplicationOverflow;
+    return snug::detail::Record(SnugIntOperation::Mult, result);
+}
+
+/**
+ * \brief Negates a SnugWide without throwing
+ *
+ * @param item value to negate
+ * @return -item, or NegationOverflow with min for min
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugIntResult<SnugWide<Bits, Policy>> SnugWide<Bits, Policy>::TryNegate(const SnugWide& item) noexcept
+{
+    SnugIntResult<SnugWide> result = {Negated(item), SnugIntError::None};
+    if (item.isNegative() && result.value.isNegative())
+        result.error = SnugIntError::NegationOverflow;
+    return snug::detail::Record(SnugIntOperation::Negate, result);
+}
+
+/**
+ * \brief Wrapped negation, 0 - item through one borrow chain
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugWide<Bits, Policy> SnugWide<Bits, Policy>::Negated(const SnugWide& item) noexcept
+{
+    SnugWide result;
+    unsigned char borrow = 0;
+    for (std::size_t i = 0; i < limbs; ++i)
+        borrow = snug::detail::SubBorrow(borrow, 0, item.limb[i], &result.limb[i]);
+    return result;
+}
+
+/**
+ * \brief Three way comparison
+ *
+ * @return a negative number, 0 or a positive number when left is below, equal to or above right
+ */
+template<std::size_t Bits, class Policy>
+constexpr int SnugWide<Bits, Policy>::Compare(const SnugWide& left, const SnugWide& right) noexcept
+{
+    if (left.isNegative() != right.isNegative())
+        return left.isNegative() ? -1 : 1;
+
+    for (std::size_t i = limbs; i-- > 0;)
+    {   // same sign, the two's complement limbs order like unsigned ones
+        if (left.limb[i] != right.limb[i])
+            return left.limb[i] < right.limb[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * \brief Resolves a SnugIntResult through the Policy
+ *
+ * \details
+ * Hands the error of a failed result to Policy, saturating towards max() for overflow errors
+ * and towards min() for underflow errors. In SNUGINT_MODE_ASSUME and SNUGINT_MODE_UNCHECKED
+ * the Policy is never consulted, as in SnugInt
+ *
+ * @param result result of one of the Try methods
+ * @return the value of result, or whatever Policy decides for a failed result
+ */
+template<std::size_t Bits, class Policy>
+constexpr SnugWide<Bits, Policy> SnugWide<Bits, Policy>::Resolve(const SnugIntResult<SnugWide>& result) noexcept(Policy::nothrow)
+{
+#if SNUGINT_MODE == SNUGINT_MODE_ASSUME
+    SNUGINT_ASSUME(result.ok());
+    return result.value;
+#elif SNUGINT_MODE == SNUGINT_MODE_UNCHECKED
+    return result.value;
+#else
+    if (SNUGINT_LIKELY(result.ok()))
+        return result.value;
+
+    snug::detail::ProfileError(result.error);
+    const bool underflow = result.error == SnugIntError::AdditionUnderflow ||
+                           result.error == SnugIntError::SubtractionUnderflow ||
+                           result.error == SnugIntError::MultiplicationUnderflow;
+    return Policy::template OnError<SnugWide>(result.error, result.value, underflow ? min() : max());
+#endif
+}
+
+/**
+ * \brief Formats a SnugWide in decimal
+ *
+ * \details
+ * The magnitude is divided into 19 digit chunks, one 128 by 64 bit division per limb and chunk,
+ * which are written with the digit pairs of to_chars
+ *
+ * @param first start of the output
+ * @param last end of the output
+ * @param value number to write
+ * @return one past the last char and None, or last and SizeMismatch when the output is too small
+ */
+template<std::size_t Bits, class P>
+snug::ToCharsResult snug::to_chars(char* first, char* last, const SnugWide<Bits, P>& value) noexcept
+{
+    constexpr std::size_t limbs = SnugWide<Bits, P>::limbs;
+    const bool negative = value.isNegative();
+    unsigned long long magnitude[limbs] = {};
+    unsigned char borrow = 0;
+    for (std::size_t i = 0; i < limbs; ++i)
+    {
+        if (negative)
+            borrow = detail::SubBorrow(borrow, 0, value.getLimb(i), &magnitude[i]);
+        else
+            magnitude[i] = value.getLimb(i);
+    }
+
+    std::uint64_t chunks[Bits / 63 + 1];   // 19 digits per chunk, lowest first
+    std::size_t count = 0;
+    std::size_t top = limbs;
+    do
+    {
+        while (top > 0 && magnitude[top - 1] == 0)
+            --top;
+        unsigned long long remainder = 0;
+        for (std::size_t i = top; i-- > 0;)
+            magnitude[i] = detail::DivStep(remainder, magnitude[i], detail::DigitChunk, &remainder);
+        chunks[count++] = remainder;
+        while (top > 0 && magnitude[top - 1] == 0)
+            --top;
+    } while (top > 0);
+
+    const std::size_t leading = detail::CountDigits(chunks[count - 1]);
+    const std::size_t length = leading + 19 * (count - 1) + negative;
+    if (last - first < static_cast<std::ptrdiff_t>(length))
+        return {last, SnugIntError::SizeMismatch};
+
+    if (negative)
+        *first = '-';
+    char* end = first + negative + leading;
+    detail::WriteDigits(end, chunks[count - 1]);
+    for (std::size_t i = count - 1; i-- > 0;)
+    {
+        end += 19;
+        detail::WriteChunk(end, chunks[i]);
+    }
+    return {first + length, SnugIntError::None};
+}
+
+/**
+ * \brief operator overload for output buffer streams
+ *
+ * \details
+ * Always decimal, written as one string through snug::to_chars so width and fill still apply
+ *
+ * @param os output stream
+ * @param data SnugWide that will be sent into the output stream
+ * @return the output stream
+ */
+template<std::size_t Bits, class P>
+std::ostream& operator<<(std::ostream& os, const SnugWide<Bits, P>& data)
+{
+    char buffer[SnugWide<Bits, P>::max_chars + 1];
+    *snug::to_chars(buffer, buffer + SnugWide<Bits, P>::max_chars, data).ptr = '\0';
+    return os << buffer;
+}
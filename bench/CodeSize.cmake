@@ -0,0 +1,62 @@
+# Compares the size of every raw_<name> / snug_<name> function pair in OBJECTS
+#
+# cmake -DNM=<nm> -DOBJECTS=<object;...> [-DBUDGET=<bytes>] -P CodeSize.cmake
+#
+# Sizes are the symbol sizes reported by nm, the .cold parts split off a function are separate symbols
+# and are not counted. A pair fails when the SnugInt function is more than BUDGET bytes (64 by default)
+# larger than the raw one. Prints the size of every pair and fails listing the pairs over the budget.
+
+if (NOT NM OR NOT OBJECTS)
+    message(FATAL_ERROR "CodeSize.cmake needs NM and OBJECTS")
+endif()
+if (NOT BUDGET)
+    set(BUDGET 64)
+endif()
+
+set(failures 0)
+set(compared 0)
+set(report "")
+
+foreach (object IN LISTS OBJECTS)
+    execute_process(COMMAND ${NM} -S ${object}
+                    OUTPUT_VARIABLE symbols
+                    RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${NM} failed on ${object}")
+    endif()
+
+    string(REPLACE "\n" ";" lines "${symbols}")
+
+    set(names "")
+    foreach (line IN LISTS lines)
+        # <address> <size> <type> <name>, local symbols like snug_add.cold do not match
+        if (line MATCHES "^[0-9a-f]+ ([0-9a-f]+) [Tt] _?((raw|snug)_[A-Za-z0-9_]+)$")
+            math(EXPR size_${CMAKE_MATCH_2} "0x${CMAKE_MATCH_1}")
+            list(APPEND names ${CMAKE_MATCH_2})
+        endif()
+    endforeach()
+
+    foreach (name IN LISTS names)
+        if (name MATCHES "^raw_(.*)$")
+            set(snug snug_${CMAKE_MATCH_1})
+            math(EXPR compared "${compared} + 1")
+            if (NOT DEFINED size_${snug})
+                message(SEND_ERROR "${snug} is missing from ${object}")
+                math(EXPR failures "${failures} + 1")
+            else()
+                math(EXPR extra "${size_${snug}} - ${size_${name}}")
+                string(APPEND report "    ${CMAKE_MATCH_1}: ${size_${name}} -> ${size_${snug}} bytes\n")
+                if (extra GREATER BUDGET)
+                    message(SEND_ERROR "${CMAKE_MATCH_1} is ${extra} bytes larger than the raw type in ${object}, the budget is ${BUDGET}")
+                    math(EXPR failures "${failures} + 1")
+                endif()
+            endif()
+        endif()
+    endforeach()
+endforeach()
+
+message(STATUS "raw -> SnugInt size of the hot path\n${report}")
+if (failures GREATER 0)
+    message(FATAL_ERROR "${failures} of ${compared} SnugInt functions are over the code size budget of ${BUDGET} bytes")
+endif()
+message(STATUS "${compared} SnugInt functions are within ${BUDGET} bytes of the raw type")
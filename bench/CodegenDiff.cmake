@@ -0,0 +1,71 @@
+# Compares the disassembly of every raw_<name> / snug_<name> function pair in OBJECTS
+#
+# cmake -DOBJDUMP=<objdump> -DOBJECTS=<object;...> -P CodegenDiff.cmake
+#
+# Addresses are stripped from every instruction, jump targets are kept as offsets into the function.
+# A pair matches when it has the same sequence of instructions, the registers may differ since the
+# compiler is free to swap the operands of a commutative operation. Fails listing both bodies of
+# every pair that differs.
+
+if (NOT OBJDUMP OR NOT OBJECTS)
+    message(FATAL_ERROR "CodegenDiff.cmake needs OBJDUMP and OBJECTS")
+endif()
+
+set(failures 0)
+set(compared 0)
+
+foreach (object IN LISTS OBJECTS)
+    execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+                    OUTPUT_VARIABLE disassembly
+                    RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${OBJDUMP} failed on ${object}")
+    endif()
+
+    # one list entry per line, ; in the disassembly would split lines so it is escaped first
+    string(REPLACE ";" "\;" disassembly "${disassembly}")
+    string(REPLACE "\n" ";" lines "${disassembly}")
+
+    set(names "")
+    set(current "")
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^[0-9a-f]+ <((raw|snug)_[A-Za-z0-9_]+)>:$")
+            set(current ${CMAKE_MATCH_1})
+            set(body_${current} "")
+            set(shape_${current} "")
+            list(APPEND names ${current})
+        elseif (current AND line MATCHES "^ *[0-9a-f]+:[ \t]+(.*)$")
+            set(instruction "${CMAKE_MATCH_1}")
+            string(REGEX REPLACE "[0-9a-f]+ <[A-Za-z0-9_.]+(\\+0x[0-9a-f]+)?>" "<\\1>" instruction "${instruction}")
+            string(REGEX REPLACE "[ \t]+" " " instruction "${instruction}")
+            string(STRIP "${instruction}" instruction)
+            # padding between functions is not part of the code
+            if (NOT instruction MATCHES "^(nop|xchg %ax,%ax|data16|cs nopw|int3)")
+                string(APPEND body_${current} "    ${instruction}\n")
+                string(REGEX MATCH "^[a-z0-9.]+" mnemonic "${instruction}")
+                string(APPEND shape_${current} "${mnemonic};")
+            endif()
+        elseif (line STREQUAL "")
+            set(current "")
+        endif()
+    endforeach()
+
+    foreach (name IN LISTS names)
+        if (name MATCHES "^raw_(.*)$")
+            set(snug snug_${CMAKE_MATCH_1})
+            math(EXPR compared "${compared} + 1")
+            if (NOT DEFINED body_${snug})
+                message(SEND_ERROR "${snug} is missing from ${object}")
+                math(EXPR failures "${failures} + 1")
+            elseif (NOT shape_${name} STREQUAL shape_${snug})
+                message(SEND_ERROR "${CMAKE_MATCH_1} differs in ${object}\nraw:\n${body_${name}}snug:\n${body_${snug}}")
+                math(EXPR failures "${failures} + 1")
+            endif()
+        endif()
+    endforeach()
+endforeach()
+
+if (failures GREATER 0)
+    message(FATAL_ERROR "${failures} of ${compared} SnugInt functions do not compile to the code of the raw type")
+endif()
+message(STATUS "${compared} SnugInt functions compile to the code of the raw type")
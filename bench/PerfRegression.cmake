@@ -0,0 +1,141 @@
+# Runs snugint_bench and compares the ns/op of every benchmark with a stored baseline
+#
+# cmake -DBENCH=<snugint_bench> -DBASELINE=<file.json> -DMODE=record|check [-DTOLERANCE=<percent>]
+#       [-DREPETITIONS=<count>] [-DFILTER=<regex>] -P PerfRegression.cmake
+#
+# Every benchmark is repeated REPETITIONS times (5 by default) and only the median cpu time is kept, which
+# is what both modes compare. record writes the Google Benchmark JSON report to BASELINE. check runs the
+# same benchmarks into <BASELINE>.current.json and fails listing every benchmark that got more than
+# TOLERANCE percent (10 by default) slower. A benchmark missing from the baseline is reported, not failed.
+
+if (NOT BENCH OR NOT BASELINE OR NOT MODE MATCHES "^(record|check)$")
+    message(FATAL_ERROR "PerfRegression.cmake needs BENCH, BASELINE and MODE=record|check")
+endif()
+if (NOT TOLERANCE)
+    set(TOLERANCE 10)
+endif()
+if (NOT REPETITIONS)
+    set(REPETITIONS 5)
+endif()
+
+# Reads the median ns/op of every benchmark in report into <prefix>_<name> and the names into <prefix>_names
+function(read_report report prefix)
+    # one list entry per line, the brackets of the JSON arrays would join list entries so they are dropped
+    file(READ ${report} text)
+    string(REGEX REPLACE "[][;]" "" text "${text}")
+    string(REPLACE "\n" ";" lines "${text}")
+    set(names "")
+    set(name "")
+    set(time "")
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^ *\"name\": \"(.*)_median\",?$")
+            set(name "${CMAKE_MATCH_1}")
+        elseif (line MATCHES "^ *\"name\":")
+            set(name "")
+        elseif (name AND line MATCHES "^ *\"cpu_time\": ([-+.0-9eE]+),?$")
+            set(time "${CMAKE_MATCH_1}")
+        elseif (name AND line MATCHES "^ *\"time_unit\": \"([a-z]+)\",?$")
+            # math() is integer only, times are kept in femtoseconds as the text of a fixed point number
+            set(scale_ns 1000000)
+            set(scale_us 1000000000)
+            set(scale_ms 1000000000000)
+            set(scale_s 1000000000000000)
+            if (NOT DEFINED scale_${CMAKE_MATCH_1})
+                message(FATAL_ERROR "${report}: unknown time unit ${CMAKE_MATCH_1} of ${name}")
+            endif()
+            femtoseconds("${time}" ${scale_${CMAKE_MATCH_1}} femto)
+            string(REPLACE "/" "|" key "${name}")
+            set(${prefix}_${key} ${femto} PARENT_SCOPE)
+            list(APPEND names "${name}")
+            set(name "")
+        endif()
+    endforeach()
+    set(${prefix}_names "${names}" PARENT_SCOPE)
+endfunction()
+
+# Converts a decimal time (2.5, 1.2e-01) times scale into an integer
+function(femtoseconds text scale out)
+    if (NOT text MATCHES "^([0-9]*)\\.?([0-9]*)([eE]([-+]?[0-9]+))?$")
+        message(FATAL_ERROR "can not read the time ${text}")
+    endif()
+    set(digits "${CMAKE_MATCH_1}${CMAKE_MATCH_2}")
+    string(LENGTH "${CMAKE_MATCH_2}" fraction)
+    set(exponent 0)
+    if (CMAKE_MATCH_4)
+        set(exponent ${CMAKE_MATCH_4})
+    endif()
+    string(LENGTH "${scale}" zeros)
+    math(EXPR shift "${zeros} - 1 + ${exponent} - ${fraction}")
+    string(REGEX REPLACE "^0+([0-9])" "\\1" digits "${digits}")
+    if (shift GREATER_EQUAL 0)
+        set(value "${digits}")
+        foreach (zero RANGE 1 ${shift})
+            if (shift GREATER 0)
+                string(APPEND value "0")
+            endif()
+        endforeach()
+    else()
+        math(EXPR keep "0 - ${shift}")
+        string(LENGTH "${digits}" length)
+        if (length GREATER keep)
+            math(EXPR length "${length} - ${keep}")
+            string(SUBSTRING "${digits}" 0 ${length} value)
+        else()
+            set(value 0)
+        endif()
+    endif()
+    set(${out} ${value} PARENT_SCOPE)
+endfunction()
+
+if (MODE STREQUAL "record")
+    set(report ${BASELINE})
+else()
+    if (NOT EXISTS ${BASELINE})
+        message(FATAL_ERROR "No baseline at ${BASELINE}, record one with the snugint_perf_baseline target")
+    endif()
+    set(report ${BASELINE}.current.json)
+endif()
+
+set(arguments --benchmark_repetitions=${REPETITIONS} --benchmark_report_aggregates_only=true
+              --benchmark_out=${report} --benchmark_out_format=json)
+if (FILTER)
+    list(APPEND arguments --benchmark_filter=${FILTER})
+endif()
+execute_process(COMMAND ${BENCH} ${arguments} OUTPUT_QUIET RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${BENCH} failed")
+endif()
+
+if (MODE STREQUAL "record")
+    read_report(${report} baseline)
+    list(LENGTH baseline_names recorded)
+    message(STATUS "Recorded the baseline of ${recorded} benchmarks in ${BASELINE}")
+    return()
+endif()
+
+read_report(${BASELINE} baseline)
+read_report(${report} current)
+
+set(failures 0)
+set(compared 0)
+foreach (name IN LISTS current_names)
+    string(REPLACE "/" "|" key "${name}")
+    if (NOT DEFINED baseline_${key})
+        message(STATUS "${name} is not in the baseline")
+        continue()
+    endif()
+
+    math(EXPR compared "${compared} + 1")
+    math(EXPR limit "${baseline_${key}} + ${baseline_${key}} * ${TOLERANCE} / 100")
+    if (current_${key} GREATER limit)
+        math(EXPR before "${baseline_${key}} / 1000")
+        math(EXPR after "${current_${key}} / 1000")
+        message(SEND_ERROR "${name} regressed from ${before} to ${after} ps/op, more than ${TOLERANCE}%")
+        math(EXPR failures "${failures} + 1")
+    endif()
+endforeach()
+
+if (failures GREATER 0)
+    message(FATAL_ERROR "${failures} of ${compared} benchmarks are more than ${TOLERANCE}% slower than ${BASELINE}")
+endif()
+message(STATUS "${compared} benchmarks are within ${TOLERANCE}% of ${BASELINE}")
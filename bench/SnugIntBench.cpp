@@ -0,0 +1,322 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <benchmark/benchmark.h>
+
+#include "SnugInt.h"
+
+/**
+ * \brief Benchmarks every SnugInt operator against the plain integral type
+ *
+ * \details
+ * Each operation is registered as op/type/raw (plain T), op/type/snug (SnugInt<T>, no overflow)
+ * and, for the operations that can fail, op/type/snug_throw (SnugInt<T>, throws every iteration)
+ *
+ * \details
+ * - The operands pass through DoNotOptimize every iteration so the operation can not be constant folded
+ *
+ * \details
+ * - The mixed ops run SnugInt op T (or T op SnugInt for the reversed ones), their raw baseline is T op T
+ */
+namespace
+{
+    struct Add
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "add"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 2; };
+        template<class T> static T OverflowLeft() { return std::numeric_limits<T>::max(); };
+        template<class T> static T OverflowRight() { return 1; };
+        template<class V, class R> static auto Run(const V& left, const R& right) -> decltype(left + right)
+        {
+            return left + right;
+        };
+    };
+
+    struct Sub
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "sub"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 2; };
+        template<class T> static T OverflowLeft() { return std::numeric_limits<T>::min(); };
+        template<class T> static T OverflowRight() { return 1; };
+        template<class V, class R> static auto Run(const V& left, const R& right) -> decltype(left - right)
+        {
+            return left - right;
+        };
+    };
+
+    struct Mult
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "mult"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 2; };
+        template<class T> static T OverflowLeft() { return std::numeric_limits<T>::max(); };
+        template<class T> static T OverflowRight() { return 2; };
+        template<class V, class R> static auto Run(const V& left, const R& right) -> decltype(left * right)
+        {
+            return left * right;
+        };
+    };
+
+    struct Div
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "div"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 2; };
+        template<class T> static T OverflowLeft() { return 6; };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static auto Run(const V& left, const R& right) -> decltype(left / right)
+        {
+            return left / right;
+        };
+    };
+
+    struct Mod
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "mod"; };
+        template<class T> static T Left() { return 7; };
+        template<class T> static T Right() { return 3; };
+        template<class T> static T OverflowLeft() { return 7; };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static auto Run(const V& left, const R& right) -> decltype(left % right)
+        {
+            return left % right;
+        };
+    };
+
+    struct Negate
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "negate"; };
+        template<class T> static T Left() { return std::is_signed<T>::value ? 6 : 0; };
+        template<class T> static T Right() { return 0; };
+        template<class T> static T OverflowLeft() { return std::is_signed<T>::value ? std::numeric_limits<T>::min() : 1; };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static V Run(const V& left, const R&) { return static_cast<V>(-left); };
+    };
+
+    struct ShiftLeft
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = true; // the count is always a plain integral
+        static const char* Name() { return "shl"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 2; };
+        template<class T> static T OverflowLeft() { return std::numeric_limits<T>::max(); };
+        template<class T> static T OverflowRight() { return 1; };
+        template<class V, class R> static V Run(const V& left, const R& right) { return static_cast<V>(left << right); };
+    };
+
+    struct And
+    {
+        static constexpr bool throws = false;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "and"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 3; };
+        template<class T> static T OverflowLeft() { return 0; };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static V Run(const V& left, const R& right) { return static_cast<V>(left & right); };
+    };
+
+    struct Increment
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "increment"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 0; };
+        template<class T> static T OverflowLeft() { return std::numeric_limits<T>::max(); };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static V Run(V left, const R&) { return ++left; };
+    };
+
+    struct Decrement
+    {
+        static constexpr bool throws = true;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "decrement"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 0; };
+        template<class T> static T OverflowLeft() { return std::numeric_limits<T>::min(); };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static V Run(V left, const R&) { return --left; };
+    };
+
+    struct Less
+    {
+        static constexpr bool throws = false;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "less"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 2; };
+        template<class T> static T OverflowLeft() { return 0; };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static bool Run(const V& left, const R& right) { return left < right; };
+    };
+
+    struct Equal
+    {
+        static constexpr bool throws = false;
+        static constexpr bool mixed = false;
+        static const char* Name() { return "equal"; };
+        template<class T> static T Left() { return 6; };
+        template<class T> static T Right() { return 2; };
+        template<class T> static T OverflowLeft() { return 0; };
+        template<class T> static T OverflowRight() { return 0; };
+        template<class V, class R> static bool Run(const V& left, const R& right) { return left == right; };
+    };
+
+    /**
+     * \brief SnugInt op T form of Op
+     */
+    template<class Op>
+    struct Mixed : Op
+    {
+        static constexpr bool mixed = true;
+    };
+
+    /**
+     * \brief T op SnugInt form of Op, the operands are stored swapped
+     */
+    template<class Op>
+    struct Reversed : Op
+    {
+        static constexpr bool mixed = true;
+        template<class T> static T Left() { return Op::template Right<T>(); };
+        template<class T> static T Right() { return Op::template Left<T>(); };
+        template<class T> static T OverflowLeft() { return Op::template OverflowRight<T>(); };
+        template<class T> static T OverflowRight() { return Op::template OverflowLeft<T>(); };
+        template<class V, class R> static auto Run(const V& left, const R& right) -> decltype(Op::Run(right, left))
+        {
+            return Op::Run(right, left);
+        };
+    };
+
+    template<class Op, class V, class R>
+    void BenchOp(benchmark::State& state, V left, R right)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(left);
+            benchmark::DoNotOptimize(right);
+            auto result = Op::Run(left, right);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<class Op, class V, class R>
+    void BenchThrow(benchmark::State& state, V left, R right)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(left);
+            benchmark::DoNotOptimize(right);
+            try
+            {
+                auto result = Op::Run(left, right);
+                benchmark::DoNotOptimize(result);
+            } catch (const std::exception& e)
+            {
+                benchmark::DoNotOptimize(&e);
+            }
+        }
+    }
+
+    template<class T, class Op>
+    void Register(const std::string& type, const char* suffix = "")
+    {
+        typedef SnugInt<T> Snug;
+        typedef typename std::conditional<Op::mixed, T, Snug>::type Right;
+        const std::string name = std::string(Op::Name()) + suffix + "/" + type;
+
+        benchmark::RegisterBenchmark((name + "/raw").c_str(), &BenchOp<Op, T, T>,
+                                     Op::template Left<T>(), Op::template Right<T>());
+        benchmark::RegisterBenchmark((name + "/snug").c_str(), &BenchOp<Op, Snug, Right>,
+                                     Snug(Op::template Left<T>()), Right(Op::template Right<T>()));
+
+        if (Op::throws)
+            benchmark::RegisterBenchmark((name + "/snug_throw").c_str(), &BenchThrow<Op, Snug, Right>,
+                                         Snug(Op::template OverflowLeft<T>()), Right(Op::template OverflowRight<T>()));
+    }
+
+    template<class T>
+    void RegisterType(const std::string& type)
+    {
+        Register<T, Add>(type);
+        Register<T, Sub>(type);
+        Register<T, Mult>(type);
+        Register<T, Div>(type);
+        Register<T, Mod>(type);
+        Register<T, Negate>(type);
+        Register<T, ShiftLeft>(type);
+        Register<T, And>(type);
+        Register<T, Increment>(type);
+        Register<T, Decrement>(type);
+        Register<T, Less>(type);
+        Register<T, Equal>(type);
+
+        Register<T, Mixed<Add>>(type, "_mixed");
+        Register<T, Mixed<Sub>>(type, "_mixed");
+        Register<T, Mixed<Mult>>(type, "_mixed");
+        Register<T, Mixed<Div>>(type, "_mixed");
+        Register<T, Mixed<Mod>>(type, "_mixed");
+        Register<T, Mixed<Less>>(type, "_mixed");
+
+        Register<T, Reversed<Add>>(type, "_reversed");
+        Register<T, Reversed<Sub>>(type, "_reversed");
+        Register<T, Reversed<Mult>>(type, "_reversed");
+        Register<T, Reversed<Div>>(type, "_reversed");
+        Register<T, Reversed<Mod>>(type, "_reversed");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    RegisterType<std::int8_t>("int8");
+    RegisterType<std::uint8_t>("uint8");
+    RegisterType<std::int16_t>("int16");
+    RegisterType<std::uint16_t>("uint16");
+    RegisterType<std::int32_t>("int32");
+    RegisterType<std::uint32_t>("uint32");
+    RegisterType<std::int64_t>("int64");
+    RegisterType<std::uint64_t>("uint64");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SnugInt.h"
+#include "SnugSize.h"
+
+#if SNUGINT_MODE != SNUGINT_MODE_CHECKED
+#error "SnugIntCodeSize.cpp measures the checked mode, build it with SNUGINT_MODE=SNUGINT_MODE_CHECKED"
+#endif
+
+/**
+ * \brief Pairs of functions for the code size check of the checked mode
+ *
+ * \details
+ * Every operation is compiled once on the raw type (raw_<op>_<type>) and once on a throwing SnugInt
+ * (snug_<op>_<type>). CodeSize.cmake reads the symbol sizes and fails when a SnugInt function is more
+ * than the budget larger than its raw one, the inlined check must stay a branch and a call into the
+ * out of line SnugIntRaise while the throw itself is paid for once.
+ *
+ * \details
+ * - Parts the compiler splits into a .cold section are not counted, they are off the hot path
+ */
+#define SNUGINT_CODESIZE_BINARY(name, op, T) \
+    extern "C" T raw_##name##_##T(T left, T right) { return static_cast<T>(left op right); } \
+    extern "C" T snug_##name##_##T(SnugInt<T> left, SnugInt<T> right) { return (left op right).getValue(); }
+
+#define SNUGINT_CODESIZE_UNARY(name, op, T) \
+    extern "C" T raw_##name##_##T(T item) { return static_cast<T>(op item); } \
+    extern "C" T snug_##name##_##T(SnugInt<T> item) { return (op item).getValue(); }
+
+#define SNUGINT_CODESIZE_SHIFT(T) \
+    extern "C" T raw_shl_##T(T left, int shift) { return static_cast<T>(left << shift); } \
+    extern "C" T snug_shl_##T(SnugInt<T> left, int shift) { return (left << shift).getValue(); }
+
+#define SNUGINT_CODESIZE_ACCUMULATE(T) \
+    extern "C" T raw_accumulate_##T(const T* data, int count) \
+    { \
+        T total = 0; \
+        for (int i = 0; i < count; ++i) \
+            total += data[i] * data[i]; \
+        return total; \
+    } \
+    extern "C" T snug_accumulate_##T(const SnugInt<T>* data, int count) \
+    { \
+        SnugInt<T> total = static_cast<T>(0); \
+        for (int i = 0; i < count; ++i) \
+            total += data[i] * data[i]; \
+        return total.getValue(); \
+    }
+
+#define SNUGINT_CODESIZE_TYPE(T) \
+    SNUGINT_CODESIZE_BINARY(add, +, T) \
+    SNUGINT_CODESIZE_BINARY(sub, -, T) \
+    SNUGINT_CODESIZE_BINARY(mult, *, T) \
+    SNUGINT_CODESIZE_BINARY(div, /, T) \
+    SNUGINT_CODESIZE_UNARY(negate, -, T) \
+    SNUGINT_CODESIZE_SHIFT(T) \
+    SNUGINT_CODESIZE_ACCUMULATE(T)
+
+SNUGINT_CODESIZE_TYPE(int32_t)
+SNUGINT_CODESIZE_TYPE(uint32_t)
+SNUGINT_CODESIZE_TYPE(int64_t)
+SNUGINT_CODESIZE_TYPE(uint64_t)
+
+extern "C" std::size_t raw_alloc_size(std::size_t count, std::size_t size, std::size_t extra) { return count * size + extra; }
+extern "C" std::size_t snug_alloc_size(std::size_t count, std::size_t size, std::size_t extra)
+{
+    return snug::checked_alloc_size(count, size, extra);
+}
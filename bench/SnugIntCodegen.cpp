@@ -0,0 +1,96 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include <cstdint>
+
+#include "SnugInt.h"
+
+#if SNUGINT_MODE != SNUGINT_MODE_UNCHECKED
+#error "SnugIntCodegen.cpp is compared in the unchecked mode, build it with SNUGINT_MODE=SNUGINT_MODE_UNCHECKED"
+#endif
+
+/**
+ * \brief Pairs of functions for the codegen diff of SNUGINT_MODE
+ *
+ * \details
+ * Every operation is compiled once on the raw type (raw_<op>_<type>) and once on SnugInt
+ * (snug_<op>_<type>). CodegenDiff.cmake disassembles the object and fails when a pair differs,
+ * in the unchecked mode a SnugInt must compile to exactly the code of its Type.
+ *
+ * \details
+ * - Division and remainder are left out, even unchecked they keep the zero divisor compare since the
+ *   Try functions still report it and the raw division by zero has no value to give
+ *
+ * \details
+ * - The assume mode is not compared, the compiler is allowed to use the promise that nothing fails
+ *   (a negated unsigned is 0) and the code is only ever smaller or rearranged
+ */
+#define SNUGINT_CODEGEN_BINARY(name, op, T) \
+    extern "C" T raw_##name##_##T(T left, T right) { return static_cast<T>(left op right); } \
+    extern "C" T snug_##name##_##T(SnugInt<T> left, SnugInt<T> right) { return (left op right).getValue(); }
+
+#define SNUGINT_CODEGEN_SHIFT(name, op, T) \
+    extern "C" T raw_##name##_##T(T left, int shift) { return static_cast<T>(left op shift); } \
+    extern "C" T snug_##name##_##T(SnugInt<T> left, int shift) { return (left op shift).getValue(); }
+
+#define SNUGINT_CODEGEN_UNARY(name, op, T) \
+    extern "C" T raw_##name##_##T(T item) { return static_cast<T>(op item); } \
+    extern "C" T snug_##name##_##T(SnugInt<T> item) { return (op item).getValue(); }
+
+#define SNUGINT_CODEGEN_COMPARE(name, op, T) \
+    extern "C" bool raw_##name##_##T(T left, T right) { return left op right; } \
+    extern "C" bool snug_##name##_##T(SnugInt<T> left, SnugInt<T> right) { return left op right; }
+
+#define SNUGINT_CODEGEN_INCREMENT(T) \
+    extern "C" T raw_increment_##T(T item) { return ++item; } \
+    extern "C" T snug_increment_##T(SnugInt<T> item) { return (++item).getValue(); }
+
+#define SNUGINT_CODEGEN_ACCUMULATE(T) \
+    extern "C" T raw_accumulate_##T(const T* data, int count) \
+    { \
+        T total = 0; \
+        for (int i = 0; i < count; ++i) \
+            total += data[i]; \
+        return total; \
+    } \
+    extern "C" T snug_accumulate_##T(const SnugInt<T>* data, int count) \
+    { \
+        SnugInt<T> total = static_cast<T>(0); \
+        for (int i = 0; i < count; ++i) \
+            total += data[i]; \
+        return total.getValue(); \
+    }
+
+#define SNUGINT_CODEGEN_TYPE(T) \
+    SNUGINT_CODEGEN_BINARY(add, +, T) \
+    SNUGINT_CODEGEN_BINARY(sub, -, T) \
+    SNUGINT_CODEGEN_BINARY(mult, *, T) \
+    SNUGINT_CODEGEN_BINARY(and, &, T) \
+    SNUGINT_CODEGEN_BINARY(or, |, T) \
+    SNUGINT_CODEGEN_BINARY(xor, ^, T) \
+    SNUGINT_CODEGEN_SHIFT(shl, <<, T) \
+    SNUGINT_CODEGEN_SHIFT(shr, >>, T) \
+    SNUGINT_CODEGEN_UNARY(negate, -, T) \
+    SNUGINT_CODEGEN_UNARY(not, ~, T) \
+    SNUGINT_CODEGEN_COMPARE(less, <, T) \
+    SNUGINT_CODEGEN_COMPARE(equal, ==, T) \
+    SNUGINT_CODEGEN_INCREMENT(T) \
+    SNUGINT_CODEGEN_ACCUMULATE(T)
+
+SNUGINT_CODEGEN_TYPE(int32_t)
+SNUGINT_CODEGEN_TYPE(uint32_t)
+SNUGINT_CODEGEN_TYPE(int64_t)
+SNUGINT_CODEGEN_TYPE(uint64_t)
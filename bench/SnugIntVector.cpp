@@ -0,0 +1,64 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+#include <cstdint>
+
+#include "SnugIntBatch.h"
+
+/**
+ * \brief Batch kernels for the vector check
+ *
+ * \details
+ * Every kernel is compiled at -O2 through its public overload (vector_<op>_<type>, vector_<op>_scalar_<type>
+ * and vector_cast_<from>_<to>). VectorCheck.cmake disassembles the object and fails when one of them,
+ * or the out of line kernel it calls, runs no packed instruction.
+ *
+ * \details
+ * - Only kernels that vectorize on the baseline of every target are listed, unsigned 64 bit sums,
+ *   32 bit products and casts out of 64 bits need 64 bit lane compares (SSE4.2 on x86-64)
+ */
+#define SNUGINT_VECTOR_BINARY(name, T) \
+    extern "C" snug::BatchResult vector_##name##_##T(const T* left, const T* right, T* out, std::size_t count) \
+    { return snug::name(left, right, out, count); } \
+    extern "C" snug::BatchResult vector_##name##_scalar_##T(const T* left, T right, T* out, std::size_t count) \
+    { return snug::name(left, right, out, count); }
+
+#define SNUGINT_VECTOR_CAST(From, To) \
+    extern "C" snug::BatchResult vector_cast_##From##_##To(const From* in, To* out, std::size_t count) \
+    { return snug::cast(in, out, count); }
+
+#define SNUGINT_VECTOR_TYPE(T) \
+    SNUGINT_VECTOR_BINARY(add, T) \
+    SNUGINT_VECTOR_BINARY(sub, T)
+
+SNUGINT_VECTOR_TYPE(int8_t)
+SNUGINT_VECTOR_TYPE(uint8_t)
+SNUGINT_VECTOR_TYPE(int16_t)
+SNUGINT_VECTOR_TYPE(uint16_t)
+SNUGINT_VECTOR_TYPE(int32_t)
+SNUGINT_VECTOR_TYPE(uint32_t)
+SNUGINT_VECTOR_TYPE(int64_t)
+
+SNUGINT_VECTOR_BINARY(mul, int8_t)
+SNUGINT_VECTOR_BINARY(mul, uint8_t)
+SNUGINT_VECTOR_BINARY(mul, int16_t)
+SNUGINT_VECTOR_BINARY(mul, uint16_t)
+
+SNUGINT_VECTOR_CAST(uint32_t, int32_t)
+SNUGINT_VECTOR_CAST(int32_t, uint8_t)
+SNUGINT_VECTOR_CAST(int32_t, int16_t)
+SNUGINT_VECTOR_CAST(int16_t, int8_t)
+SNUGINT_VECTOR_CAST(uint16_t, uint8_t)
@@ -0,0 +1,71 @@
+# Checks that every vector_<name> function in OBJECTS runs packed SIMD instructions
+#
+# cmake -DOBJDUMP=<objdump> -DOBJECTS=<object;...> -P VectorCheck.cmake
+#
+# A function passes when its own body, or the body of a function it calls or jumps to directly (the
+# out of line batch kernel), has a packed integer instruction: p* / vp* on an xmm, ymm or zmm register
+# on x86, an arrangement like v0.4s on AArch64. Fails listing every function that stayed scalar, which
+# is what a compiler or flag change that stops vectorizing the batch kernels looks like.
+
+if (NOT OBJDUMP OR NOT OBJECTS)
+    message(FATAL_ERROR "VectorCheck.cmake needs OBJDUMP and OBJECTS")
+endif()
+
+set(failures "")
+set(checked 0)
+
+foreach (object IN LISTS OBJECTS)
+    execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+                    OUTPUT_VARIABLE disassembly
+                    RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${OBJDUMP} failed on ${object}")
+    endif()
+
+    # one list entry per line, ; in the disassembly would split lines so it is escaped first
+    string(REPLACE ";" "\;" disassembly "${disassembly}")
+    string(REPLACE "\n" ";" lines "${disassembly}")
+
+    set(names "")
+    set(current "")
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^[0-9a-f]+ <([^>]+)>:$")
+            string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_1}" current)
+            set(simd_${current} FALSE)
+            set(targets_${current} "")
+            if (CMAKE_MATCH_1 MATCHES "^vector_")
+                list(APPEND names ${current})
+            endif()
+        elseif (current AND line MATCHES "^ *[0-9a-f]+:[ \t]+(.*)$")
+            set(instruction "${CMAKE_MATCH_1}")
+            if (instruction MATCHES "^v?p[a-z0-9]+[ \t].*%[xyz]mm" OR instruction MATCHES "[ \t,]v[0-9]+\\.[0-9]+[bhsd]")
+                set(simd_${current} TRUE)
+            elseif (instruction MATCHES "^(call|jmp|bl|b)[a-z]*[ \t]+[0-9a-f]+ <([^>+]+)(\\+0x[0-9a-f]+)?>")
+                string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_2}" target)
+                list(APPEND targets_${current} ${target})
+            endif()
+        elseif (line STREQUAL "")
+            set(current "")
+        endif()
+    endforeach()
+
+    foreach (name IN LISTS names)
+        math(EXPR checked "${checked} + 1")
+        set(vectorized ${simd_${name}})
+        foreach (target IN LISTS targets_${name})
+            if (simd_${target})
+                set(vectorized TRUE)
+            endif()
+        endforeach()
+        if (NOT vectorized)
+            list(APPEND failures ${name})
+        endif()
+    endforeach()
+endforeach()
+
+list(LENGTH failures failed)
+if (failed GREATER 0)
+    string(REPLACE ";" "\n    " failures "${failures}")
+    message(FATAL_ERROR "${failed} of ${checked} batch kernels have no vector instructions:\n    ${failures}")
+endif()
+message(STATUS "${checked} batch kernels run vector instructions")
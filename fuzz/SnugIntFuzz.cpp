@@ -0,0 +1,1465 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#include "SnugInt.h"
+#include "SnugIntBatch.h"
+#include "SnugIntExpr.h"
+#include "SnugIntReduce.h"
+#include "SnugIntParallel.h"
+#include "SnugIntColumn.h"
+#include "SnugAtomic.h"
+#include "SnugCounter.h"
+#include "SnugDivisor.h"
+#include "SnugFixed.h"
+#include "SnugRange.h"
+#include "SnugSize.h"
+#include "SnugWide.h"
+
+#if SNUGINT_MODE != SNUGINT_MODE_CHECKED
+#error "SnugIntFuzz.cpp checks the policies, build it with SNUGINT_MODE=SNUGINT_MODE_CHECKED"
+#endif
+
+/**
+ * \brief Differential fuzz target of every SnugInt backend and policy
+ *
+ * \details
+ * The input is read once per integral width, from 8 to 128 bits. Every pair of operands is run through
+ * the checked arithmetic backend of the build (SnugInt::Try*), the portable sign case checks, the mixed
+ * checks with a 64 bit operand (remainders included), the batch kernels and parallel_transform, the reductions
+ * and parallel_sum, the expression templates, SnugAtomic, SnugCounter, SnugDivisor, SnugRange, SnugScaled, the
+ * conversions to every other width, to_chars / from_chars and the column decoder, the size and index helpers of
+ * SnugSize.h with SnugAllocator and all the policies. Each of them is compared bit for bit with a reference that
+ * computes the exact result in __int128 (up to 32 bit operands) or a 384 bit SnugWide, wide enough for three
+ * 128 bit factors, and the first mismatch aborts with the operands. Decimal text is built digit by digit and the
+ * fixed point results are rounded by the definition of each rounding in __int128.
+ *
+ * \details
+ * - Every operand starts with a shape byte, so short inputs reach 0, small values and the limits of a width
+ *   instead of only random bit patterns
+ *
+ * \details
+ * - LLVMFuzzerTestOneInput is the libFuzzer entry point, SnugIntFuzzMain.cpp drives the same function from
+ *   files, stdin (AFL) or a random generator
+ */
+namespace
+{
+    /**
+     * \brief Type the exact result of an operation on two T (or a T and a 64 bit integral) is computed in
+     */
+#if SNUGINT_HAS_INT128
+    template<class T>
+    struct Reference : std::conditional<(sizeof(T) < 8), __int128, SnugWide<384, SnugIntWrapPolicy>> {};
+#else
+    template<class T>
+    struct Reference { typedef SnugWide<384, SnugIntWrapPolicy> type; };
+#endif
+
+    // 64 bit operand of the mixed checks, of the other signedness than T
+    template<class T>
+    struct Other : std::conditional<snug::detail::IsSigned<T>::value, unsigned long long, long long> {};
+
+    /**
+     * \brief Remaining fuzz input, reads zeros once it is used up
+     */
+    struct Input
+    {
+        const std::uint8_t* data;
+        std::size_t size;
+
+        bool empty() const noexcept { return size == 0; };
+
+        std::uint8_t Byte() noexcept
+        {
+            if (size == 0)
+                return 0;
+            --size;
+            return *data++;
+        }
+
+        template<class T>
+        T Value() noexcept
+        {
+            typedef typename snug::detail::MakeUnsigned<T>::type Bits;
+            const std::uint8_t shape = Byte();
+            Bits bits = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+                bits = static_cast<Bits>(static_cast<Bits>(bits << 4 << 4) | Byte());
+
+            const Bits low = static_cast<Bits>(bits & 0xff);
+            switch (shape & 3)
+            {
+                case 1: // small, [-128, 127] for a signed T
+                    return snug::detail::IsSigned<T>::value ? static_cast<T>(static_cast<signed char>(low)) : static_cast<T>(low);
+                case 2:
+                    return static_cast<T>(static_cast<Bits>(std::numeric_limits<T>::max()) - low);
+                case 3:
+                    return static_cast<T>(static_cast<Bits>(std::numeric_limits<T>::min()) + low);
+                default:
+                    return static_cast<T>(bits);
+            }
+        }
+    };
+
+    // Hex text of an operand for the mismatch report
+    struct Text
+    {
+        char chars[2 + 32 + 1];
+    };
+
+    template<class T>
+    Text HexOf(T item) noexcept
+    {
+        typedef typename snug::detail::MakeUnsigned<T>::type Bits;
+        Text text = {{'0', 'x'}};
+        const Bits bits = static_cast<Bits>(item);
+        for (std::size_t i = 0; i < 2 * sizeof(T); ++i)
+            text.chars[2 + i] = "0123456789abcdef"[static_cast<unsigned>(bits >> (4 * (2 * sizeof(T) - 1 - i))) & 15];
+        text.chars[2 + 2 * sizeof(T)] = '\0';
+        return text;
+    }
+
+    // Decimal text of an integer, the reference of to_chars
+    struct Decimal
+    {
+        char chars[48];
+        std::size_t size;
+    };
+
+    template<class T>
+    Decimal DecimalOf(T item) noexcept
+    {
+        typedef typename snug::detail::MakeUnsigned<T>::type Bits;
+        Bits magnitude = snug::detail::IsNegative(item) ? static_cast<Bits>(Bits(0) - static_cast<Bits>(item)) : static_cast<Bits>(item);
+        char digits[48];
+        std::size_t count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + static_cast<int>(magnitude % 10));
+            magnitude = static_cast<Bits>(magnitude / 10);
+        } while (magnitude != 0);
+
+        Decimal text = {{}, 0};
+        if (snug::detail::IsNegative(item))
+            text.chars[text.size++] = '-';
+        while (count != 0)
+            text.chars[text.size++] = digits[--count];
+        return text;
+    }
+
+    /**
+     * \brief Operands of the current check, printed when it fails
+     */
+    struct Case
+    {
+        const char* type;
+        const char* operation;
+        Text left;
+        Text right;
+    };
+
+    void Expect(bool condition, const Case& current, const char* check) noexcept
+    {
+        if (condition)
+            return;
+        std::fprintf(stderr, "SnugInt mismatch: %s %s %s %s, %s\n",
+                     current.left.chars, current.operation, current.right.chars, current.type, check);
+        std::abort();
+    }
+
+    template<class T>
+    bool Same(const SnugIntResult<T>& left, const SnugIntResult<T>& right) noexcept
+    {
+        return left.error == right.error && left.value == right.value;
+    }
+
+    // Type of the exception item throws, void when it does not throw
+    template<class Function>
+    const std::type_info& ThrownBy(Function item)
+    {
+        try
+        {
+            item();
+        } catch (const std::exception& error)
+        {
+            return typeid(error);
+        }
+        return typeid(void);
+    }
+
+    /**
+     * \brief Result the reference expects for the exact value of an operation
+     */
+    template<class T, class R>
+    SnugIntResult<T> Expected(const R& exact, SnugIntError overflow, SnugIntError underflow)
+    {
+        SnugIntResult<T> result = {static_cast<T>(exact), SnugIntError::None};
+        if (exact > R(std::numeric_limits<T>::max()))
+            result.error = overflow;
+        else if (exact < R(std::numeric_limits<T>::min()))
+            result.error = underflow;
+        return result;
+    }
+
+    // Value of a SnugIntSaturatePolicy SnugInt after result, overflow and division errors go to max
+    template<class T>
+    T SaturatedOf(const SnugIntResult<T>& result) noexcept
+    {
+        switch (result.error)
+        {
+            case SnugIntError::None:
+                return result.value;
+            case SnugIntError::AdditionUnderflow:
+            case SnugIntError::SubtractionUnderflow:
+            case SnugIntError::MultiplicationUnderflow:
+            case SnugIntError::ShiftUnderflow:
+            case SnugIntError::DivisionUnderflow:
+            case SnugIntError::NegationUnderflow:
+                return std::numeric_limits<T>::min();
+            default:
+                return std::numeric_limits<T>::max();
+        }
+    }
+
+    // true when item needs more than the 256 bits the widest expressions are evaluated in
+    template<class R>
+    bool Outside256(const R& item)
+    {
+        R limit = R(1);
+        for (int i = 0; i < 255; ++i)
+            limit = limit + limit;
+        return item >= limit || item < R(0) - limit;
+    }
+
+#if SNUGINT_HAS_INT128
+    bool Outside256(__int128) { return false; }
+#endif
+
+    struct Add
+    {
+        static const char* Name() { return "+"; };
+        static SnugIntError Overflow() { return SnugIntError::AdditionOverflow; };
+        static SnugIntError Underflow() { return SnugIntError::AdditionUnderflow; };
+        template<class L, class R> static auto Run(const L& left, const R& right) -> decltype(left + right) { return left + right; };
+        template<class T> static SnugIntResult<T> Try(T left, T right) { return SnugInt<T>::TryAdd(left, right); };
+        template<class Res, class T, class U> static SnugIntResult<Res> TryMixed(T left, U right) { return SnugInt<Res>::TryAdd(left, right); };
+        template<class T, class U, class Res, class Narrow> static bool Portable(T left, U right, Res* result, Narrow narrow)
+        {
+            return snug::detail::PortableMixedAdd(left, right, result, narrow);
+        };
+        template<class T> static bool Portable(T left, T right, T* result)
+        {
+            return snug::detail::PortableAdd(left, right, result, snug::detail::IsSigned<T>());
+        };
+        template<class A> static snug::BatchResult Batch(const A* left, const A* right, A* out, std::size_t count) { return snug::add(left, right, out, count); };
+        template<class A> static snug::BatchResult Batch(const A* left, A right, A* out, std::size_t count) { return snug::add(left, right, out, count); };
+        template<class T, class P> static SnugIntResult<T> Atomic(SnugAtomic<T, P>& item, T right) { return item.TryFetchAdd(right); };
+        typedef snug::AddOp Transform;
+    };
+
+    struct Sub
+    {
+        static const char* Name() { return "-"; };
+        static SnugIntError Overflow() { return SnugIntError::SubtractionOverflow; };
+        static SnugIntError Underflow() { return SnugIntError::SubtractionUnderflow; };
+        template<class L, class R> static auto Run(const L& left, const R& right) -> decltype(left - right) { return left - right; };
+        template<class T> static SnugIntResult<T> Try(T left, T right) { return SnugInt<T>::TrySub(left, right); };
+        template<class Res, class T, class U> static SnugIntResult<Res> TryMixed(T left, U right) { return SnugInt<Res>::TrySub(left, right); };
+        template<class T, class U, class Res, class Narrow> static bool Portable(T left, U right, Res* result, Narrow narrow)
+        {
+            return snug::detail::PortableMixedSub(left, right, result, narrow);
+        };
+        template<class T> static bool Portable(T left, T right, T* result)
+        {
+            return snug::detail::PortableSub(left, right, result, snug::detail::IsSigned<T>());
+        };
+        template<class A> static snug::BatchResult Batch(const A* left, const A* right, A* out, std::size_t count) { return snug::sub(left, right, out, count); };
+        template<class A> static snug::BatchResult Batch(const A* left, A right, A* out, std::size_t count) { return snug::sub(left, right, out, count); };
+        template<class T, class P> static SnugIntResult<T> Atomic(SnugAtomic<T, P>& item, T right) { return item.TryFetchSub(right); };
+        typedef snug::SubOp Transform;
+    };
+
+    struct Mult
+    {
+        static const char* Name() { return "*"; };
+        static SnugIntError Overflow() { return SnugIntError::MultiplicationOverflow; };
+        static SnugIntError Underflow() { return SnugIntError::MultiplicationUnderflow; };
+        template<class L, class R> static auto Run(const L& left, const R& right) -> decltype(left * right) { return left * right; };
+        template<class T> static SnugIntResult<T> Try(T left, T right) { return SnugInt<T>::TryMult(left, right); };
+        template<class Res, class T, class U> static SnugIntResult<Res> TryMixed(T left, U right) { return SnugInt<Res>::TryMult(left, right); };
+        template<class T, class U, class Res, class Narrow> static bool Portable(T left, U right, Res* result, Narrow narrow)
+        {
+            return snug::detail::PortableMixedMult(left, right, result, narrow);
+        };
+        template<class T> static bool Portable(T left, T right, T* result)
+        {
+            return snug::detail::PortableMult(left, right, result, snug::detail::IsSigned<T>());
+        };
+        template<class A> static snug::BatchResult Batch(const A* left, const A* right, A* out, std::size_t count) { return snug::mul(left, right, out, count); };
+        template<class A> static snug::BatchResult Batch(const A* left, A right, A* out, std::size_t count) { return snug::mul(left, right, out, count); };
+        template<class T, class P> static SnugIntResult<T> Atomic(SnugAtomic<T, P>& item, T right) { return item.TryFetchMult(right); };
+        typedef snug::MulOp Transform;
+    };
+
+    /**
+     * \brief SnugAtomic agrees with the reference, the value is kept on failure
+     */
+    template<class Op, class T>
+    void CheckAtomic(T left, T right, const SnugIntResult<T>& expected, const Case& current, std::true_type)
+    {
+        SnugAtomic<T, SnugIntWrapPolicy> item(left);
+        const SnugIntResult<T> previous = Op::Atomic(item, right);
+        Expect(previous.error == expected.error && previous.value == left, current, "SnugAtomic result");
+        Expect(item.load() == (expected.ok() ? expected.value : left), current, "SnugAtomic value");
+    }
+
+    template<class Op, class T>
+    void CheckAtomic(T, T, const SnugIntResult<T>&, const Case&, std::false_type) {}
+
+    /**
+     * \brief SnugAtomic driven to max from four threads, small and large steps up and down
+     *
+     * \details
+     * The value starts one large step and one below max, so the large steps take it to the limit while the
+     * small ones run from the middle of the range. Every accepted step must fit on the previous value it reports,
+     * every refused one overflow it, and the final value must be the start plus the accepted steps, so no step
+     * was applied to a value that was not real
+     */
+    template<class T>
+    void CheckAtomicThreads(const char* type, T left, std::true_type)
+    {
+        typedef typename Reference<T>::type R;
+        const T steps[2] = {static_cast<T>((left & 3) + 1), static_cast<T>(std::numeric_limits<T>::max() / 2)};
+        const T start = static_cast<T>(std::numeric_limits<T>::max() - steps[1] - 1);
+        const Case current = {type, "SnugAtomic threads", HexOf(start), HexOf(steps[0])};
+        SnugAtomic<T, SnugIntWrapPolicy> item(start);
+        std::size_t accepted[4] = {0, 0, 0, 0};
+
+        const auto run = [&](int worker)
+        {
+            const bool up = worker % 2 == 0;
+            const T step = steps[worker / 2];
+            for (int i = 0; i < 1000; ++i)
+            {
+                const SnugIntResult<T> previous = up ? item.TryFetchAdd(step) : item.TryFetchSub(step);
+                const R next = up ? R(previous.value) + R(step) : R(previous.value) - R(step);
+                const bool fits = next <= R(std::numeric_limits<T>::max()) && next >= R(std::numeric_limits<T>::min());
+                Expect(previous.ok() == fits, current, "SnugAtomic threads step against its previous value");
+                accepted[worker] += previous.ok() ? 1 : 0;
+            }
+        };
+        std::thread workers[3] = {std::thread(run, 1), std::thread(run, 2), std::thread(run, 3)};
+        run(0);
+        for (std::thread& worker : workers)
+            worker.join();
+
+        const R expected = R(start) + R(steps[0]) * R(accepted[0]) - R(steps[0]) * R(accepted[1])
+                           + R(steps[1]) * R(accepted[2]) - R(steps[1]) * R(accepted[3]);
+        Expect(R(item.load()) == expected, current, "SnugAtomic threads final value");
+    }
+
+    template<class T>
+    void CheckAtomicThreads(const char*, T, std::false_type) {}
+
+#if SNUGINT_HAS_INT128
+    /**
+     * \brief Mixed operands of up to 64 bits checked against a 128 bit Result, by the build and the portable backend
+     */
+    template<class Op, class Res, class T, class U>
+    void CheckWideResult(const Case& current, T left, U right, std::true_type)
+    {
+        typedef typename Reference<Res>::type R;
+        const SnugIntResult<Res> exact = Expected<Res>(Op::Run(R(left), R(right)), Op::Overflow(), Op::Underflow());
+        Expect(Same(Op::template TryMixed<Res>(left, right), exact), current, "mixed SnugInt::Try 128 bit result");
+        Res wide = 0;
+        const bool wide_failed = Op::Portable(left, right, &wide, snug::detail::MixedNarrow<T, U>());
+        Expect(wide_failed == !exact.ok() && wide == exact.value, current, "portable mixed backend 128 bit result");
+    }
+
+    template<class Op, class Res, class T, class U>
+    void CheckWideResult(const Case&, T, U, std::false_type) {}
+#endif
+
+    /**
+     * \brief Every backend and policy of one binary operation on left and right
+     */
+    template<class Op, class T>
+    void CheckBinary(const char* type, T left, T right, typename Other<T>::type other)
+    {
+        typedef typename Reference<T>::type R;
+        typedef typename Other<T>::type U;
+        const Case current = {type, Op::Name(), HexOf(left), HexOf(right)};
+
+        const SnugIntResult<T> expected = Expected<T>(Op::Run(R(left), R(right)), Op::Overflow(), Op::Underflow());
+        Expect(Same(Op::Try(left, right), expected), current, "SnugInt::Try");
+
+        T portable = 0;
+        const bool portable_failed = Op::Portable(left, right, &portable);
+        Expect(portable_failed == !expected.ok() && portable == expected.value, current, "portable backend");
+
+        // the policies
+        Expect(Op::Run(SnugInt<T, SnugIntWrapPolicy>(left), SnugInt<T, SnugIntWrapPolicy>(right)).getValue() == expected.value,
+               current, "SnugIntWrapPolicy");
+        Expect(Op::Run(SnugInt<T, SnugIntSaturatePolicy>(left), SnugInt<T, SnugIntSaturatePolicy>(right)).getValue() == SaturatedOf(expected),
+               current, "SnugIntSaturatePolicy");
+        SnugIntFlagPolicy::clear();
+        Expect(Op::Run(SnugInt<T, SnugIntFlagPolicy>(left), SnugInt<T, SnugIntFlagPolicy>(right)).getValue() == expected.value &&
+               SnugIntFlagPolicy::error() == expected.error, current, "SnugIntFlagPolicy");
+        Expect(ThrownBy([&] { Op::Run(SnugInt<T>(left), SnugInt<T>(right)); }) == ThrownBy([&] { SnugIntThrow(expected.error); }),
+               current, "SnugIntThrowPolicy");
+
+        // expressions, straight and after a product so the wider evaluation tiers are reached
+        const SnugIntResult<T> expression = Op::Run(snug::expr(left), right).template Try<T>();
+        Expect(expression.error == expected.error && (!expected.ok() || expression.value == expected.value), current, "snug::expr");
+        const R product = Op::Run(R(left) * R(right), R(right));
+        SnugIntResult<T> chained = Expected<T>(product, Op::Overflow(), Op::Underflow());
+        if (!chained.ok() && Outside256(product))
+            chained.error = Op::Overflow(); // an intermediate that does not fit in the 256 bit SnugWide is an overflow
+        const SnugIntResult<T> chain = Op::Run(snug::expr(left) * right, right).template Try<T>();
+        Expect(chain.error == chained.error && (!chained.ok() || chain.value == chained.value), current, "snug::expr chain");
+        const SnugInt<T, SnugIntSaturatePolicy> saturated = Op::Run(snug::expr(left) * right, right);
+        Expect(saturated.getValue() == SaturatedOf(chained), current, "snug::expr chain saturated");
+
+        CheckAtomic<Op>(left, right, expected, current, std::integral_constant<bool, (sizeof(T) <= 8)>());
+
+        // mixed with a 64 bit operand of the other signedness
+        const Case mixed = {type, Op::Name(), HexOf(left), HexOf(other)};
+        const SnugIntResult<T> exact = Expected<T>(Op::Run(R(left), R(other)), Op::Overflow(), Op::Underflow());
+        Expect(Same(Op::template TryMixed<T>(left, other), exact), mixed, "mixed SnugInt::Try");
+        T narrow = 0;
+        const bool narrow_failed = Op::Portable(left, other, &narrow, snug::detail::MixedNarrow<T, U>());
+        Expect(narrow_failed == !exact.ok() && narrow == exact.value, mixed, "portable mixed backend");
+#if SNUGINT_HAS_INT128
+        CheckWideResult<Op, __int128>(mixed, left, other, std::integral_constant<bool, (sizeof(T) <= 8)>());
+        CheckWideResult<Op, unsigned __int128>(mixed, left, other, std::integral_constant<bool, (sizeof(T) <= 8)>());
+#endif
+    }
+
+    /**
+     * \brief The batch kernels agree with the element wise reference
+     */
+    template<class Op, class T>
+    void CheckBatch(const char* type, const T* left, const T* right, std::size_t count)
+    {
+        static const std::size_t capacity = 64;
+        T out[capacity];
+        SnugInt<T, SnugIntSaturatePolicy> snug_left[capacity];
+        SnugInt<T, SnugIntSaturatePolicy> snug_right[capacity];
+        SnugInt<T, SnugIntSaturatePolicy> snug_out[capacity];
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            snug_left[i] = left[i];
+            snug_right[i] = right[i];
+        }
+
+        for (int broadcast = 0; broadcast < 2; ++broadcast)
+        {
+            const snug::BatchResult raw = broadcast ? Op::Batch(left, right[0], out, count) : Op::Batch(left, right, out, count);
+            const snug::BatchResult snug = broadcast ? Op::Batch(snug_left, snug_right[0], snug_out, count)
+                                                     : Op::Batch(snug_left, snug_right, snug_out, count);
+
+            snug::BatchResult expected = {SnugIntError::None, count};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const T operand = right[broadcast ? 0 : i];
+                const Case current = {type, broadcast ? "batch broadcast" : "batch", HexOf(left[i]), HexOf(operand)};
+                const SnugIntResult<T> element = Op::Try(left[i], operand);
+                Expect(out[i] == element.value, current, "raw batch element");
+                Expect(snug_out[i].getValue() == SaturatedOf(element), current, "SnugInt batch element");
+                if (expected.ok() && !element.ok())
+                    expected = {element.error, i};
+            }
+
+            const Case current = {type, broadcast ? "batch broadcast" : "batch", HexOf(left[0]), HexOf(right[0])};
+            Expect(raw.error == expected.error && raw.index == expected.index, current, "raw BatchResult");
+            Expect(snug.error == expected.error && snug.index == expected.index, current, "SnugInt BatchResult");
+        }
+    }
+
+    /**
+     * \brief SnugDivisor agrees with the division of SnugInt
+     */
+    template<class T>
+    void CheckDivisor(T left, T right, const Case& current, std::true_type)
+    {
+        const SnugDivisor<T, SnugIntWrapPolicy> divisor(right);
+        Expect(Same(divisor.TryDiv(left), SnugInt<T>::TryDiv(left, right)), current, "SnugDivisor::TryDiv");
+        Expect(Same(divisor.TryMod(left), SnugInt<T>::TryMod(left, right)), current, "SnugDivisor::TryMod");
+    }
+
+    template<class T>
+    void CheckDivisor(T, T, const Case&, std::false_type) {}
+
+    /**
+     * \brief Remainder of left / right in sign magnitude, right is not zero
+     *
+     * \details
+     * The remainder is smaller than both operands and has the sign of left, so the only one that does not fit
+     * in T is a negative one for an unsigned T
+     */
+    template<class T, class L, class R>
+    SnugIntResult<T> RemainderOf(L left, R right) noexcept
+    {
+        typedef typename std::conditional<(sizeof(L) > 8 || sizeof(R) > 8),
+                                          typename snug::detail::MakeUnsigned<typename std::conditional<(sizeof(L) > sizeof(R)), L, R>::type>::type,
+                                          unsigned long long>::type Magnitude;
+        const Magnitude dividend = snug::detail::IsNegative(left) ? Magnitude(0) - Magnitude(left) : Magnitude(left);
+        const Magnitude divisor = snug::detail::IsNegative(right) ? Magnitude(0) - Magnitude(right) : Magnitude(right);
+        const Magnitude magnitude = dividend % divisor;
+        const bool negative = snug::detail::IsNegative(left) && magnitude != 0;
+        return {static_cast<T>(negative ? Magnitude(0) - magnitude : magnitude),
+                negative && !snug::detail::IsSigned<T>::value ? SnugIntError::DivisionUnderflow : SnugIntError::None};
+    }
+
+    /**
+     * \brief Mixed remainders with a 64 bit operand of the other signedness, in either order and under every Policy
+     */
+    template<class T>
+    void CheckMixedMod(const char* type, T left, typename Other<T>::type other)
+    {
+        const Case current = {type, "mixed %", HexOf(left), HexOf(other)};
+        const SnugIntResult<T> zero = {0, SnugIntError::DivisionByZero};
+        const SnugIntResult<T> remainder = other == 0 ? zero : RemainderOf<T>(left, other);
+        const SnugIntResult<T> reversed = left == 0 ? zero : RemainderOf<T>(other, left);
+        Expect(Same(SnugInt<T>::TryMod(left, other), remainder), current, "mixed SnugInt::TryMod");
+        Expect(Same(SnugInt<T>::TryMod(other, left), reversed), current, "mixed SnugInt::TryMod reversed");
+
+        Expect((SnugInt<T, SnugIntWrapPolicy>(left) % other).getValue() == remainder.value, current, "mixed % SnugIntWrapPolicy");
+        Expect((other % SnugInt<T, SnugIntSaturatePolicy>(left)).getValue() == SaturatedOf(reversed), current, "mixed % SnugIntSaturatePolicy");
+        SnugIntFlagPolicy::clear();
+        SnugInt<T, SnugIntFlagPolicy> flagged(left);
+        flagged %= other;
+        Expect(flagged.getValue() == remainder.value && SnugIntFlagPolicy::error() == remainder.error, current, "mixed %= SnugIntFlagPolicy");
+        Expect(ThrownBy([&] { SnugInt<T>(left) % SnugInt<typename Other<T>::type>(other); }) == ThrownBy([&] { SnugIntThrow(remainder.error); }),
+               current, "mixed % SnugIntThrowPolicy");
+    }
+
+    /**
+     * \brief The operations that have a single implementation, against their definition
+     */
+    template<class T>
+    void CheckUnary(const char* type, T left, T right)
+    {
+        typedef typename Reference<T>::type R;
+        const Case current = {type, "/ % - << abs", HexOf(left), HexOf(right)};
+
+        // division truncates towards zero like the built in operator, that fails on 0 and min / -1
+        const bool zero = right == 0;
+        const bool wraps = snug::detail::IsSigned<T>::value && left == std::numeric_limits<T>::min() && right == static_cast<T>(-1);
+        const SnugIntResult<T> quotient = {zero ? T(0) : wraps ? left : static_cast<T>(left / right),
+                                           zero ? SnugIntError::DivisionByZero : wraps ? SnugIntError::DivisionOverflow : SnugIntError::None};
+        const SnugIntResult<T> remainder = {zero || wraps ? T(0) : static_cast<T>(left % right),
+                                            zero ? SnugIntError::DivisionByZero : SnugIntError::None};
+        Expect(Same(SnugInt<T>::TryDiv(left, right), quotient), current, "SnugInt::TryDiv");
+        Expect(Same(SnugInt<T>::TryMod(left, right), remainder), current, "SnugInt::TryMod");
+        CheckDivisor(left, right, current, std::integral_constant<bool, (sizeof(T) <= 8)>());
+
+        const SnugIntResult<T> negated = Expected<T>(R(0) - R(left), SnugIntError::NegationOverflow, SnugIntError::NegationUnderflow);
+        Expect(Same(SnugInt<T>::TryNegate(left), negated), current, "SnugInt::TryNegate");
+        Expect(Same(SnugInt<T>::TryAbs(left), snug::detail::IsNegative(left) ? negated : SnugIntResult<T>{left, SnugIntError::None}),
+               current, "SnugInt::TryAbs");
+
+        // shift counts one past the width on either side
+        const int width = static_cast<int>(sizeof(T) * 8);
+        const int shift = static_cast<int>(static_cast<unsigned>(right) % static_cast<unsigned>(width + 3)) - 1;
+        const SnugIntResult<T> shifted = SnugInt<T>::TryShiftLeft(left, shift);
+        if (shift < 0 || shift >= width)
+            Expect(shifted.error == SnugIntError::ShiftOutOfRange, current, "SnugInt::TryShiftLeft range");
+        else
+        {
+            R power = R(1);
+            for (int i = 0; i < shift; ++i)
+                power = power + power;
+            Expect(Same(shifted, Expected<T>(R(left) * power, SnugIntError::ShiftOverflow, SnugIntError::ShiftUnderflow)),
+                   current, "SnugInt::TryShiftLeft");
+        }
+
+        // a count of the operand type, up to 128 bits, is only in range when it is below the width
+        const bool in_range = R(right) >= R(0) && R(right) < R(width);
+        const SnugIntResult<T> left_count = SnugInt<T>::TryShiftLeft(left, right);
+        const SnugIntResult<T> right_count = SnugInt<T>::TryShiftRight(left, right);
+        Expect(in_range ? Same(left_count, SnugInt<T>::TryShiftLeft(left, static_cast<int>(right)))
+                        : left_count.error == SnugIntError::ShiftOutOfRange, current, "SnugInt::TryShiftLeft count of type");
+        Expect(in_range ? Same(right_count, SnugInt<T>::TryShiftRight(left, static_cast<int>(right)))
+                        : right_count.error == SnugIntError::ShiftOutOfRange, current, "SnugInt::TryShiftRight count of type");
+#if SNUGINT_HAS_INT128
+        // an in range count plus 2^64 must not be truncated back into range
+        const unsigned __int128 far = (static_cast<unsigned __int128>(1) << 64) + static_cast<unsigned>(shift < 0 ? 0 : shift);
+        Expect(SnugInt<T>::TryShiftLeft(left, far).error == SnugIntError::ShiftOutOfRange, current, "SnugInt::TryShiftLeft 128 bit count");
+        Expect(SnugInt<T>::TryShiftRight(left, far).error == SnugIntError::ShiftOutOfRange, current, "SnugInt::TryShiftRight 128 bit count");
+        Expect(SnugInt<T>::TryShiftLeft(left, static_cast<__int128>(far)).error == SnugIntError::ShiftOutOfRange &&
+               SnugInt<T>::TryShiftLeft(left, -static_cast<__int128>(far)).error == SnugIntError::ShiftOutOfRange,
+               current, "SnugInt::TryShiftLeft signed 128 bit count");
+#endif
+    }
+
+    /**
+     * \brief Every conversion of item to To against a range check in the 384 bit reference
+     */
+    template<class To, class From>
+    void CheckCast(const char* type, const char* to, From item)
+    {
+        typedef SnugWide<384, SnugIntWrapPolicy> R;
+        const Case current = {type, to, HexOf(item), HexOf(static_cast<To>(item))};
+        const bool fits = R(item) >= R(std::numeric_limits<To>::min()) && R(item) <= R(std::numeric_limits<To>::max());
+        const SnugIntResult<To> expected = {static_cast<To>(item), fits ? SnugIntError::None : SnugIntError::SizeMismatch};
+        const To saturated = fits ? expected.value : snug::detail::IsNegative(item) ? std::numeric_limits<To>::min()
+                                                                                   : std::numeric_limits<To>::max();
+
+        Expect(Same(snug_try_cast<To>(item), expected), current, "snug_try_cast");
+        Expect(Same(SnugInt<To>::TryFrom(item), expected), current, "SnugInt::TryFrom");
+        Expect(SnugInt<To, SnugIntSaturatePolicy>(item).getValue() == saturated, current, "SnugInt constructor saturated");
+        Expect(snug_cast<SnugInt<To, SnugIntSaturatePolicy>>(item).getValue() == saturated, current, "snug_cast saturated");
+        Expect((ThrownBy([&] { SnugInt<To> converted(item); static_cast<void>(converted); }) == typeid(void)) == fits,
+               current, "SnugInt constructor");
+
+        To out = 0;
+        const snug::BatchResult batch = snug::cast(&item, &out, 1);
+        Expect(batch.error == expected.error && out == expected.value, current, "snug::cast");
+    }
+
+    /**
+     * \brief item into a SnugWide<128> and back, only an unsigned __int128 of 2^127 or more does not fit
+     */
+    template<class From>
+    void CheckWideCast(const char* type, From item)
+    {
+        const Case current = {type, "to SnugWide<128>", HexOf(item), HexOf(item)};
+        const bool fits = snug::detail::IsSigned<From>::value || sizeof(From) < 16 || (item >> (sizeof(From) * 8 - 1)) == 0;
+        const SnugIntResult<SnugWide<128, SnugIntWrapPolicy>> wide = SnugWide<128, SnugIntWrapPolicy>::TryFrom(item);
+        Expect(wide.ok() == fits, current, "SnugWide<128>::TryFrom");
+        Expect(Same(wide.value.template TryTo<From>(), fits ? SnugIntResult<From>{item, SnugIntError::None}
+                                                             : SnugIntResult<From>{item, SnugIntError::SizeMismatch}),
+               current, "SnugWide<128>::TryTo");
+        Expect(SnugWide<128, SnugIntSaturatePolicy>(item) == (fits ? SnugWide<128, SnugIntSaturatePolicy>::TryFrom(item).value
+                                                                   : SnugWide<128, SnugIntSaturatePolicy>::max()),
+               current, "SnugWide<128> SnugIntSaturatePolicy");
+    }
+
+    template<class From>
+    void CheckCasts(const char* type, From item)
+    {
+        CheckWideCast(type, item);
+        CheckCast<std::int8_t>(type, "to int8", item);
+        CheckCast<std::uint8_t>(type, "to uint8", item);
+        CheckCast<std::int16_t>(type, "to int16", item);
+        CheckCast<std::uint16_t>(type, "to uint16", item);
+        CheckCast<std::int32_t>(type, "to int32", item);
+        CheckCast<std::uint32_t>(type, "to uint32", item);
+        CheckCast<std::int64_t>(type, "to int64", item);
+        CheckCast<std::uint64_t>(type, "to uint64", item);
+#if SNUGINT_HAS_INT128
+        CheckCast<__int128>(type, "to int128", item);
+        CheckCast<unsigned __int128>(type, "to uint128", item);
+#endif
+    }
+
+    // Base of a SnugAllocator that hands out no memory, allocate only has to get past the size check
+    template<class T>
+    struct NoMemory
+    {
+        typedef T value_type;
+        NoMemory() = default;
+        template<class U> NoMemory(const NoMemory<U>&) noexcept {};
+        T* allocate(std::size_t) noexcept { return nullptr; };
+        void deallocate(T*, std::size_t) noexcept {};
+        template<class U> bool operator == (const NoMemory<U>&) const noexcept { return true; };
+    };
+
+    struct Element
+    {
+        char bytes[24];
+    };
+
+    /**
+     * \brief A checked size or index under one Policy, every failure saturates to SIZE_MAX
+     */
+    template<class Policy, class Function>
+    void CheckSizePolicy(const SnugIntResult<std::size_t>& expected, const Case& current, const char* check, Function item)
+    {
+        SnugIntFlagPolicy::clear();
+        if (std::is_same<Policy, SnugIntThrowPolicy>::value)
+            Expect(ThrownBy(item) == (expected.ok() ? typeid(void) : ThrownBy([&] { SnugIntThrow(expected.error); })), current, check);
+        else if (std::is_same<Policy, SnugIntSaturatePolicy>::value)
+            Expect(item() == (expected.ok() ? expected.value : std::numeric_limits<std::size_t>::max()), current, check);
+        else
+            Expect(item() == expected.value && (!std::is_same<Policy, SnugIntFlagPolicy>::value || SnugIntFlagPolicy::error() == expected.error),
+                   current, check);
+    }
+
+    template<class Policy, class T>
+    void CheckSizes(const Case& current, T count, std::size_t size, std::size_t extra, std::size_t limit,
+                    const SnugIntResult<std::size_t>& expected, const SnugIntResult<std::size_t>& below)
+    {
+        CheckSizePolicy<Policy>(expected, current, "snug::checked_alloc_size", [&] { return snug::checked_alloc_size<Policy>(count, size, extra); });
+        CheckSizePolicy<Policy>(expected, current, "snug::checked_index", [&] { return snug::checked_index<Policy>(count, size, extra); });
+        CheckSizePolicy<Policy>(below, current, "snug::checked_index limit", [&] { return snug::checked_index<Policy>(count, size, extra, limit); });
+
+        // a size that fails never reaches Base, one that fits always does
+        const std::size_t elements = static_cast<std::size_t>(count);
+        const SnugIntResult<std::size_t> bytes = snug::try_alloc_size(elements, sizeof(Element));
+        SnugAllocator<Element, Policy, NoMemory<Element>> allocator;
+        const std::type_info& thrown = ThrownBy([&] { allocator.allocate(elements); });
+        Expect(bytes.ok() ? thrown == typeid(void)
+                          : thrown == typeid(std::bad_array_new_length) ||
+                            (std::is_same<Policy, SnugIntThrowPolicy>::value && thrown == ThrownBy([&] { SnugIntThrow(bytes.error); })),
+               current, "SnugAllocator::allocate");
+    }
+
+    /**
+     * \brief The fused size and index helpers of SnugSize.h against the reference, under every Policy
+     */
+    template<class T>
+    void CheckSize(const char* type, T count, std::size_t size, std::size_t extra)
+    {
+        typedef SnugWide<384, SnugIntWrapPolicy> R;
+        const Case current = {type, "* size +", HexOf(count), HexOf(size)};
+
+        // the product fails first, a negative one as an underflow, then the sum
+        const R product = R(count) * R(size);
+        SnugIntResult<std::size_t> expected = {static_cast<std::size_t>(product + R(extra)), SnugIntError::None};
+        if (product < R(0))
+            expected.error = SnugIntError::MultiplicationUnderflow;
+        else if (product > R(std::numeric_limits<std::size_t>::max()))
+            expected.error = SnugIntError::MultiplicationOverflow;
+        else if (product + R(extra) > R(std::numeric_limits<std::size_t>::max()))
+            expected.error = SnugIntError::AdditionOverflow;
+        Expect(Same(snug::try_alloc_size(count, size, extra), expected), current, "snug::try_alloc_size");
+        Expect(Same(snug::try_index(count, size, extra), expected), current, "snug::try_index");
+
+        // a limit one past the index for an odd size, at the index for an even one
+        const std::size_t limit = expected.value + (size & 1);
+        SnugIntResult<std::size_t> below = expected;
+        if (below.ok() && below.value >= limit)
+            below.error = SnugIntError::SizeMismatch;
+        Expect(Same(snug::try_index(count, size, extra, limit), below), current, "snug::try_index limit");
+
+        CheckSizes<SnugIntWrapPolicy>(current, count, size, extra, limit, expected, below);
+        CheckSizes<SnugIntSaturatePolicy>(current, count, size, extra, limit, expected, below);
+        CheckSizes<SnugIntFlagPolicy>(current, count, size, extra, limit, expected, below);
+        CheckSizes<SnugIntThrowPolicy>(current, count, size, extra, limit, expected, below);
+    }
+
+    /**
+     * \brief snug::product of every prefix of data against the exact product
+     *
+     * \details
+     * The reference magnitude is clamped at 2^129, past every limit, so 64 factors of 128 bits stay inside
+     * the 384 bit SnugWide
+     */
+    template<class T>
+    void CheckProduct(const char* type, const T* data, std::size_t count)
+    {
+        typedef SnugWide<384, SnugIntWrapPolicy> R;
+        typedef typename std::conditional<(sizeof(T) > 8), typename snug::detail::MakeUnsigned<T>::type, unsigned long long>::type Bits;
+        R clamp = R(1);
+        for (int i = 0; i < 129; ++i)
+            clamp = clamp + clamp;
+
+        R magnitude = R(1);
+        Bits wrapped = 1;
+        bool negative = false;
+        bool zero = false;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Case current = {type, "snug::product", HexOf(data[0]), HexOf(data[i])};
+            magnitude = magnitude * (snug::detail::IsNegative(data[i]) ? R(0) - R(data[i]) : R(data[i]));
+            if (magnitude > clamp)
+                magnitude = clamp;
+            wrapped = static_cast<Bits>(wrapped * static_cast<Bits>(data[i]));
+            negative ^= snug::detail::IsNegative(data[i]);
+            zero = zero || data[i] == 0;
+
+            SnugIntResult<T> expected = Expected<T>(negative ? R(0) - magnitude : magnitude, SnugIntError::MultiplicationOverflow,
+                                                    SnugIntError::MultiplicationUnderflow);
+            expected.value = static_cast<T>(wrapped);
+            if (zero)
+                expected = {0, SnugIntError::None};
+            Expect(Same(snug::product(data, i + 1), expected), current, "snug::product");
+        }
+    }
+
+    // Products that overflow on the way and land exactly on min, or one past it
+    template<class T>
+    void CheckProductEdges(const char* type, std::true_type)
+    {
+        const T half = static_cast<T>(std::numeric_limits<T>::min() / 2);
+        const T edges[][4] = {{half, -2, -1, 1}, {static_cast<T>(-half), 2, -1, -1}, {-1, half, 2, -1}, {half, 2, -1, -1},
+                              {static_cast<T>(-half), -2, 1, 1}, {std::numeric_limits<T>::min(), -1, -1, 1},
+                              {std::numeric_limits<T>::max(), -1, -1, 1}, {half, 4, -1, 0}};
+        for (const T (&edge)[4] : edges)
+            CheckProduct(type, edge, 4);
+    }
+
+    template<class T>
+    void CheckProductEdges(const char* type, std::false_type)
+    {
+        const T half = static_cast<T>(std::numeric_limits<T>::max() / 2 + 1);
+        const T edges[][3] = {{half, 2, 1}, {half, 1, 2}, {half, 2, 0}, {std::numeric_limits<T>::max(), 1, 1}};
+        for (const T (&edge)[3] : edges)
+            CheckProduct(type, edge, 3);
+    }
+
+    /**
+     * \brief snug::sum and snug::dot of every prefix against the exact sums, raw and saturated
+     */
+    template<class T>
+    void CheckReduce(const char* type, const T* left, const T* right, std::size_t count)
+    {
+        typedef typename Reference<T>::type R;
+        static const std::size_t capacity = 64;
+        SnugInt<T, SnugIntSaturatePolicy> snug_left[capacity];
+        SnugInt<T, SnugIntSaturatePolicy> snug_right[capacity];
+
+        R total = R(0);
+        R dot = R(0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Case current = {type, "snug::sum snug::dot", HexOf(left[i]), HexOf(right[i])};
+            snug_left[i] = left[i];
+            snug_right[i] = right[i];
+            total = total + R(left[i]);
+            dot = dot + R(left[i]) * R(right[i]);
+
+            const SnugIntResult<T> sum = Expected<T>(total, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow);
+            const SnugIntResult<T> product = Expected<T>(dot, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow);
+            Expect(Same(snug::sum(left, i + 1), sum), current, "snug::sum");
+            Expect(snug::sum(snug_left, i + 1).getValue() == SaturatedOf(sum), current, "snug::sum saturated");
+            Expect(Same(snug::dot(left, right, i + 1), product), current, "snug::dot");
+            Expect(snug::dot(snug_left, snug_right, i + 1).getValue() == SaturatedOf(product), current, "snug::dot saturated");
+        }
+    }
+
+    /**
+     * \brief parallel_transform of one operation against the element wise reference, raw and saturated
+     */
+    template<class Op, class T>
+    void CheckParallelTransform(const char* type, const std::vector<T>& left, const std::vector<T>& right, std::size_t cycle,
+                                unsigned threads)
+    {
+        typedef SnugInt<T, SnugIntSaturatePolicy> Saturated;
+        const std::size_t size = left.size();
+        std::vector<T> out(size);
+        std::vector<Saturated> snug_left(left.begin(), left.end());
+        std::vector<Saturated> snug_right(right.begin(), right.end());
+        std::vector<Saturated> snug_out(size);
+
+        for (int broadcast = 0; broadcast < 2; ++broadcast)
+        {
+            const snug::BatchResult raw = broadcast ? snug::parallel_transform(left.data(), right[0], out.data(), size, typename Op::Transform(), threads)
+                                                    : snug::parallel_transform(left.data(), right.data(), out.data(), size, typename Op::Transform(), threads);
+            const snug::BatchResult snug = broadcast ? snug::parallel_transform(snug_left.data(), snug_right[0], snug_out.data(), size, typename Op::Transform(), threads)
+                                                     : snug::parallel_transform(snug_left.data(), snug_right.data(), snug_out.data(), size, typename Op::Transform(), threads);
+
+            // the operands repeat every cycle elements, so do the results and the first failure is in the first cycle
+            std::vector<SnugIntResult<T>> elements(cycle);
+            snug::BatchResult expected = {SnugIntError::None, size};
+            for (std::size_t i = 0; i < cycle; ++i)
+            {
+                elements[i] = Op::Try(left[i], right[broadcast ? 0 : i]);
+                if (expected.ok() && !elements[i].ok())
+                    expected = {elements[i].error, i};
+            }
+            std::size_t mismatch = 0;
+            while (mismatch < size && out[mismatch] == elements[mismatch % cycle].value &&
+                   snug_out[mismatch].getValue() == SaturatedOf(elements[mismatch % cycle]))
+                ++mismatch;
+
+            const std::size_t at = mismatch < size ? mismatch : 0;
+            const Case current = {type, broadcast ? "snug::parallel_transform broadcast" : "snug::parallel_transform",
+                                  HexOf(left[at]), HexOf(right[broadcast ? 0 : at])};
+            Expect(mismatch == size, current, "snug::parallel_transform element");
+            Expect(raw.error == expected.error && raw.index == expected.index, current, "raw parallel BatchResult");
+            Expect(snug.error == expected.error && snug.index == expected.index, current, "SnugInt parallel BatchResult");
+        }
+    }
+
+    /**
+     * \brief parallel_sum and parallel_transform on three threads, over the operands repeated past two chunks
+     */
+    template<class T>
+    void CheckParallel(const char* type, const T* left, const T* right, std::size_t count)
+    {
+        typedef typename Reference<T>::type R;
+        const unsigned threads = 3;
+        const std::size_t size = 2 * snug::detail::ParallelChunk<T>() + count;
+        std::vector<T> data(size);
+        std::vector<T> other(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            data[i] = left[i % count];
+            other[i] = right[i % count];
+        }
+
+        R cycle = R(0);
+        R rest = R(0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            cycle = cycle + R(left[i]);
+            if (i < size % count)
+                rest = rest + R(left[i]);
+        }
+        const SnugIntResult<T> sum = Expected<T>(cycle * R(size / count) + rest, SnugIntError::AdditionOverflow,
+                                                 SnugIntError::AdditionUnderflow);
+
+        // the Policy sees the failure once, on the calling thread
+        const Case current = {type, "snug::parallel_sum", HexOf(left[0]), HexOf(left[count - 1])};
+        Expect(Same(snug::parallel_sum(data.data(), size, threads), sum), current, "snug::parallel_sum");
+        const std::vector<SnugInt<T, SnugIntSaturatePolicy>> saturated(data.begin(), data.end());
+        Expect(snug::parallel_sum(saturated.data(), size, threads).getValue() == SaturatedOf(sum), current, "snug::parallel_sum saturated");
+        const std::vector<SnugInt<T, SnugIntFlagPolicy>> flagged(data.begin(), data.end());
+        SnugIntFlagPolicy::clear();
+        Expect(snug::parallel_sum(flagged.data(), size, threads).getValue() == sum.value && SnugIntFlagPolicy::error() == sum.error,
+               current, "snug::parallel_sum SnugIntFlagPolicy");
+        const std::vector<SnugInt<T>> throwing(data.begin(), data.end());
+        Expect(ThrownBy([&] { snug::parallel_sum(throwing.data(), size, threads); }) == ThrownBy([&] { SnugIntThrow(sum.error); }),
+               current, "snug::parallel_sum SnugIntThrowPolicy");
+
+        CheckParallelTransform<Add>(type, data, other, count, threads);
+        CheckParallelTransform<Sub>(type, data, other, count, threads);
+        CheckParallelTransform<Mult>(type, data, other, count, threads);
+    }
+
+    // Result of parsing the text of item followed by a 7, one digit longer than item
+    template<class T>
+    SnugIntResult<T> LongerOf(T item)
+    {
+        typedef typename Reference<T>::type R;
+        const R digit = snug::detail::IsNegative(item) ? R(0) - R(7) : R(7);
+        return Expected<T>(R(item) * R(10) + digit, SnugIntError::MultiplicationOverflow, SnugIntError::MultiplicationUnderflow);
+    }
+
+    /**
+     * \brief to_chars and from_chars against the decimal text of item
+     */
+    template<class T>
+    void CheckChars(const char* type, T item)
+    {
+        const Case current = {type, "to_chars from_chars", HexOf(item), HexOf(item)};
+        const Decimal text = DecimalOf(item);
+        const std::size_t sign = snug::detail::IsNegative(item) ? 1 : 0;
+        const T untouched = static_cast<T>(~item);
+
+        char buffer[snug::max_chars];
+        Expect(text.size <= snug::max_chars, current, "snug::max_chars");
+        const snug::ToCharsResult written = snug::to_chars(buffer, buffer + snug::max_chars, item);
+        Expect(written.ok() && written.ptr == buffer + text.size && std::equal(text.chars, text.chars + text.size, buffer),
+               current, "snug::to_chars");
+        const snug::ToCharsResult snug_written = snug::to_chars(buffer, buffer + text.size, SnugInt<T, SnugIntSaturatePolicy>(item));
+        Expect(snug_written.ok() && snug_written.ptr == buffer + text.size && std::equal(text.chars, text.chars + text.size, buffer),
+               current, "snug::to_chars SnugInt");
+        const snug::ToCharsResult short_written = snug::to_chars(buffer, buffer + text.size - 1, item);
+        Expect(short_written.error == SnugIntError::SizeMismatch && short_written.ptr == buffer + text.size - 1,
+               current, "snug::to_chars buffer one char short");
+
+        T value = untouched;
+        snug::FromCharsResult parsed = snug::from_chars(text.chars, text.chars + text.size, value);
+        Expect(parsed.ok() && parsed.ptr == text.chars + text.size && value == item, current, "snug::from_chars");
+
+        // leading zeros after the sign and a char that is not a digit after the number
+        char padded[sizeof(text.chars) + 3];
+        std::copy(text.chars, text.chars + sign, padded);
+        padded[sign] = '0';
+        padded[sign + 1] = '0';
+        std::copy(text.chars + sign, text.chars + text.size, padded + sign + 2);
+        padded[text.size + 2] = 'x';
+        value = untouched;
+        parsed = snug::from_chars(padded, padded + text.size + 3, value);
+        Expect(parsed.ok() && parsed.ptr == padded + text.size + 2 && value == item, current, "snug::from_chars leading zeros");
+
+        // one more digit, every digit is consumed and a failure leaves the value untouched
+        char longer[sizeof(text.chars) + 1];
+        std::copy(text.chars, text.chars + text.size, longer);
+        longer[text.size] = '7';
+        const SnugIntResult<T> expected = LongerOf(item);
+        value = untouched;
+        parsed = snug::from_chars(longer, longer + text.size + 1, value);
+        Expect(parsed.error == expected.error && parsed.ptr == longer + text.size + 1 && value == (expected.ok() ? expected.value : untouched),
+               current, "snug::from_chars one digit more");
+        SnugInt<T, SnugIntSaturatePolicy> snug_value(untouched);
+        parsed = snug::from_chars(longer, longer + text.size + 1, snug_value);
+        Expect(parsed.error == expected.error && snug_value.getValue() == (expected.ok() ? expected.value : untouched),
+               current, "snug::from_chars SnugInt");
+
+        // no number, and a minus sign for an unsigned T
+        char minus[sizeof(text.chars) + 1] = {'-'};
+        std::copy(text.chars + sign, text.chars + text.size, minus + 1);
+        const char* const invalid[] = {"", "-", "+1", "-x", "x1", snug::detail::IsSigned<T>::value ? "" : minus};
+        for (const char* bad : invalid)
+        {
+            value = item;
+            parsed = snug::from_chars(bad, bad + std::strlen(bad), value);
+            Expect(parsed.error == SnugIntError::InvalidFormat && parsed.ptr == bad && value == item, current, "snug::from_chars InvalidFormat");
+        }
+
+        // the stream skips one leading '+' before a number that is not negative, as std::num_get does
+        const std::string digits(text.chars, text.chars + text.size);
+        std::istringstream stream(digits + (sign ? " +0" : " +" + digits) + " ++1");
+        SnugInt<T, SnugIntSaturatePolicy> streamed(untouched);
+        Expect(static_cast<bool>(stream >> streamed) && streamed.getValue() == item, current, "operator>>");
+        streamed = SnugInt<T, SnugIntSaturatePolicy>(untouched);
+        Expect(static_cast<bool>(stream >> streamed) && streamed.getValue() == (sign ? T(0) : item), current, "operator>> leading plus");
+        streamed = SnugInt<T, SnugIntSaturatePolicy>(untouched);
+        Expect(!(stream >> streamed) && streamed.getValue() == untouched, current, "operator>> two leading pluses");
+    }
+
+    /**
+     * \brief One decode against the results of its fields, in text order
+     */
+    template<class T>
+    void CheckDecoded(const Case& current, const char* check, const snug::ColumnResult& result, const T* out,
+                      const std::uint64_t* errors, const std::vector<SnugIntResult<T>>& fields, std::size_t count, const char* ptr)
+    {
+        snug::ColumnResult expected = {SnugIntError::None, count, count, 0, ptr};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const bool failed = !fields[i].ok();
+            Expect(out[i] == (failed ? T(0) : fields[i].value) && ((errors[i / 64] >> (i % 64)) & 1) == (failed ? 1u : 0u), current, check);
+            if (failed && expected.ok())
+            {
+                expected.error = fields[i].error;
+                expected.index = i;
+            }
+            expected.failed += failed ? 1 : 0;
+        }
+        Expect(result.error == expected.error && result.index == expected.index && result.count == expected.count &&
+               result.failed == expected.failed && result.ptr == expected.ptr, current, check);
+    }
+
+    /**
+     * \brief decode_values and decode_column of lines built from the decimal text of the operands
+     *
+     * \details
+     * Every line holds a left and a right field and every other line ends with \r\n. Every fourth left field gets
+     * one more digit, that may not fit, and the one after it a char that is not a digit
+     */
+    template<class T>
+    void CheckColumn(const char* type, const T* left, const T* right, std::size_t count)
+    {
+        std::vector<char> text;
+        std::vector<SnugIntResult<T>> values;
+        std::vector<SnugIntResult<T>> columns[3];
+        std::vector<std::size_t> starts; // of every field, then of every line
+        std::vector<std::size_t> lines;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            lines.push_back(text.size());
+            starts.push_back(text.size());
+            const Decimal first = DecimalOf(left[i]);
+            text.insert(text.end(), first.chars, first.chars + first.size);
+            SnugIntResult<T> field = {left[i], SnugIntError::None};
+            if (i % 4 == 2)
+            {
+                text.push_back('7');
+                field = LongerOf(left[i]);
+            } else if (i % 4 == 3)
+            {
+                text.push_back('x');
+                field.error = SnugIntError::InvalidFormat;
+            }
+            text.push_back(',');
+
+            starts.push_back(text.size());
+            const Decimal second = DecimalOf(right[i]);
+            text.insert(text.end(), second.chars, second.chars + second.size);
+            if (i % 2 == 1)
+                text.push_back('\r');
+            text.push_back('\n');
+
+            values.push_back(field);
+            values.push_back({right[i], SnugIntError::None});
+            columns[0].push_back(field);
+            columns[1].push_back({right[i], SnugIntError::None});
+            columns[2].push_back({0, SnugIntError::InvalidFormat});
+        }
+
+        const std::size_t fields = 2 * count;
+        const char* const first = text.data();
+        const char* const last = first + text.size();
+        const char* const open = last - (count % 2 == 0 ? 2 : 1); // the last line without its newline
+        std::vector<T> out(fields);
+        std::vector<std::uint64_t> errors(snug::error_words(fields));
+        const Case current = {type, "decode_values decode_column", HexOf(left[0]), HexOf(right[0])};
+
+        std::fill(errors.begin(), errors.end(), ~std::uint64_t(0));
+        CheckDecoded(current, "snug::decode_values", snug::decode_values(first, last, ',', out.data(), fields, errors.data()),
+                     out.data(), errors.data(), values, fields, last);
+        std::fill(errors.begin(), errors.end(), ~std::uint64_t(0));
+        CheckDecoded(current, "snug::decode_values incomplete", snug::decode_values(first, open, ',', out.data(), fields, errors.data(), false),
+                     out.data(), errors.data(), values, fields - 1, first + starts[fields - 1]);
+
+        std::vector<SnugInt<T, SnugIntSaturatePolicy>> snug_out(fields);
+        std::fill(errors.begin(), errors.end(), ~std::uint64_t(0));
+        const snug::ColumnResult snug = snug::decode_values(first, last, ',', snug_out.data(), fields, errors.data());
+        for (std::size_t i = 0; i < fields; ++i)
+            out[i] = snug_out[i].getValue();
+        CheckDecoded(current, "snug::decode_values SnugInt", snug, out.data(), errors.data(), values, fields, last);
+
+        for (std::size_t column = 0; column < 3; ++column)
+        {
+            std::fill(errors.begin(), errors.end(), ~std::uint64_t(0));
+            CheckDecoded(current, "snug::decode_column", snug::decode_column(first, last, ',', column, out.data(), count, errors.data()),
+                         out.data(), errors.data(), columns[column], count, last);
+        }
+        std::fill(errors.begin(), errors.end(), ~std::uint64_t(0));
+        CheckDecoded(current, "snug::decode_column incomplete", snug::decode_column(first, open, ',', 1, out.data(), count, errors.data(), false),
+                     out.data(), errors.data(), columns[1], count - 1, first + lines[count - 1]);
+    }
+
+#if SNUGINT_HAS_INT128
+    /**
+     * \brief Rounded magnitude / divisor by the definition of Rounding
+     */
+    template<class Rounding>
+    unsigned __int128 RoundedOf(unsigned __int128 magnitude, unsigned __int128 divisor, bool negative)
+    {
+        const unsigned __int128 quotient = magnitude / divisor;
+        const unsigned __int128 remainder = magnitude % divisor;
+        bool up = false;
+        if (std::is_same<Rounding, SnugRoundFloor>::value)
+            up = negative && remainder != 0;
+        else if (std::is_same<Rounding, SnugRoundCeil>::value)
+            up = !negative && remainder != 0;
+        else if (std::is_same<Rounding, SnugRoundHalfAway>::value)
+            up = 2 * remainder >= divisor;
+        else if (std::is_same<Rounding, SnugRoundHalfEven>::value)
+            up = 2 * remainder > divisor || (2 * remainder == divisor && (quotient & 1) != 0);
+        return quotient + (up ? 1 : 0);
+    }
+
+    // Raw SnugScaled result of a magnitude and sign, the value only counts when it fits
+    template<class T>
+    SnugIntResult<T> ScaledOf(unsigned __int128 magnitude, bool negative, SnugIntError overflow, SnugIntError underflow)
+    {
+        typedef unsigned __int128 Wide;
+        const Wide limit = negative ? Wide(0) - static_cast<Wide>(static_cast<__int128>(std::numeric_limits<T>::min()))
+                                    : static_cast<Wide>(std::numeric_limits<T>::max());
+        SnugIntResult<T> result = {static_cast<T>(negative ? Wide(0) - magnitude : magnitude), SnugIntError::None};
+        if (magnitude > limit)
+            result.error = negative ? underflow : overflow;
+        return result;
+    }
+
+    template<class T>
+    unsigned __int128 WideMagnitude(T item)
+    {
+        return snug::detail::IsNegative(item) ? 0 - static_cast<unsigned __int128>(item) : static_cast<unsigned __int128>(item);
+    }
+
+    /**
+     * \brief SnugScaled of one Unit and Rounding on the raw values left and right, under every Policy
+     */
+    template<class T, unsigned long long Unit, class Rounding>
+    void CheckScaled(const char* type, T left, T right)
+    {
+        typedef SnugScaled<T, Unit, Rounding, SnugIntWrapPolicy> Scaled;
+        typedef SnugScaled<T, Unit, Rounding, SnugIntSaturatePolicy> Saturated;
+        typedef SnugScaled<T, Unit, Rounding> Throwing;
+        const Case current = {type, "SnugScaled", HexOf(left), HexOf(right)};
+        const bool negative = snug::detail::IsNegative(left) != snug::detail::IsNegative(right);
+
+        const SnugIntResult<T> product = ScaledOf<T>(RoundedOf<Rounding>(WideMagnitude(left) * WideMagnitude(right), Unit, negative),
+                                                     negative, SnugIntError::MultiplicationOverflow, SnugIntError::MultiplicationUnderflow);
+        const SnugIntResult<T> multiplied = Scaled::TryMult(Scaled::fromRaw(left), Scaled::fromRaw(right));
+        Expect(multiplied.error == product.error && (!product.ok() || multiplied.value == product.value), current, "SnugScaled::TryMult");
+
+        SnugIntResult<T> quotient = {0, SnugIntError::DivisionByZero};
+        if (right != 0)
+            quotient = ScaledOf<T>(RoundedOf<Rounding>(WideMagnitude(left) * Unit, WideMagnitude(right), negative),
+                                   negative, SnugIntError::DivisionOverflow, SnugIntError::DivisionUnderflow);
+        const SnugIntResult<T> divided = Scaled::TryDiv(Scaled::fromRaw(left), Scaled::fromRaw(right));
+        Expect(divided.error == quotient.error && (!quotient.ok() || divided.value == quotient.value), current, "SnugScaled::TryDiv");
+
+        const bool sign = snug::detail::IsNegative(left);
+        const unsigned __int128 integer = RoundedOf<Rounding>(WideMagnitude(left), Unit, sign);
+        Expect(Scaled::fromRaw(left).toInteger() == static_cast<T>(sign ? 0 - integer : integer), current, "SnugScaled::toInteger");
+
+        const SnugIntResult<T> scaled = ScaledOf<T>(WideMagnitude(left) * Unit, sign, SnugIntError::MultiplicationOverflow,
+                                                    SnugIntError::MultiplicationUnderflow);
+        const SnugIntResult<T> from = Scaled::TryFrom(left);
+        Expect(from.error == scaled.error && (!scaled.ok() || from.value == scaled.value), current, "SnugScaled::TryFrom");
+
+        // the policies
+        Expect((Saturated::fromRaw(left) * Saturated::fromRaw(right)).getRaw() == SaturatedOf(product), current, "SnugScaled * saturated");
+        Expect((Saturated::fromRaw(left) / Saturated::fromRaw(right)).getRaw() == SaturatedOf(quotient), current, "SnugScaled / saturated");
+        Expect(Saturated(left).getRaw() == SaturatedOf(scaled), current, "SnugScaled constructor saturated");
+        Expect(ThrownBy([&] { Throwing::fromRaw(left) * Throwing::fromRaw(right); }) == ThrownBy([&] { SnugIntThrow(product.error); }),
+               current, "SnugScaled * SnugIntThrowPolicy");
+        Expect(ThrownBy([&] { Throwing::fromRaw(left) / Throwing::fromRaw(right); }) == ThrownBy([&] { SnugIntThrow(quotient.error); }),
+               current, "SnugScaled / SnugIntThrowPolicy");
+        Expect(ThrownBy([&] { Throwing converted(left); static_cast<void>(converted); }) == ThrownBy([&] { SnugIntThrow(scaled.error); }),
+               current, "SnugScaled constructor");
+    }
+
+    template<class T, unsigned long long Unit>
+    void CheckRoundings(const char* type, T left, T right)
+    {
+        CheckScaled<T, Unit, SnugRoundTruncate>(type, left, right);
+        CheckScaled<T, Unit, SnugRoundFloor>(type, left, right);
+        CheckScaled<T, Unit, SnugRoundCeil>(type, left, right);
+        CheckScaled<T, Unit, SnugRoundHalfAway>(type, left, right);
+        CheckScaled<T, Unit, SnugRoundHalfEven>(type, left, right);
+    }
+
+    // Binary units of half and all but one of the bits of T, and a decimal one
+    template<class T>
+    void CheckScaledUnits(const char* type, T left, T right, std::true_type)
+    {
+        CheckRoundings<T, (1ull << (sizeof(T) * 4 - 1))>(type, left, right);
+        CheckRoundings<T, (1ull << (sizeof(T) * 8 - 1))>(type, left, right);
+        CheckRoundings<T, snug::detail::FixedPower(2)>(type, left, right);
+    }
+
+    template<class T>
+    void CheckScaledUnits(const char*, T, T, std::false_type) {}
+#endif
+
+    /**
+     * \brief One SnugRange operation under Policy, the SnugInt result clamped into the bounds of the result
+     */
+    template<class Op, class Policy, class T, T Min, T Max>
+    void CheckRangeOp(const char* type, T left, T right)
+    {
+        typedef SnugRange<T, Min, Max, Policy> Range;
+        typedef decltype(Op::Run(Range(left), Range(right))) Result;
+        const Case current = {type, Op::Name(), HexOf(left), HexOf(right)};
+        const SnugIntResult<T> expected = Op::Try(left, right);
+        Expect(!expected.ok() || (expected.value >= Result::min && expected.value <= Result::max), current, "SnugRange bounds");
+
+        if (std::is_same<Policy, SnugIntThrowPolicy>::value)
+        {
+            Expect(ThrownBy([&] { Op::Run(Range(left), Range(right)); }) == ThrownBy([&] { SnugIntThrow(expected.error); }),
+                   current, "SnugRange SnugIntThrowPolicy");
+            return;
+        }
+        T item = std::is_same<Policy, SnugIntSaturatePolicy>::value ? SaturatedOf(expected) : expected.value;
+        item = item < Result::min ? T(Result::min) : item > Result::max ? T(Result::max) : item;
+        Expect(Op::Run(Range(left), Range(right)).getValue() == item, current, "SnugRange");
+    }
+
+    template<class T, T Min, T Max, class Policy>
+    void CheckRangePolicy(const char* type, T left, T right)
+    {
+        CheckRangeOp<Add, Policy, T, Min, Max>(type, left, right);
+        CheckRangeOp<Sub, Policy, T, Min, Max>(type, left, right);
+        CheckRangeOp<Mult, Policy, T, Min, Max>(type, left, right);
+    }
+
+    /**
+     * \brief SnugRange over half and the whole of T, the operands are clamped into the half range
+     */
+    template<class T>
+    void CheckRange(const char* type, T left, T right, std::true_type)
+    {
+        constexpr T low = static_cast<T>(std::numeric_limits<T>::min() / 2);
+        constexpr T high = static_cast<T>(std::numeric_limits<T>::max() / 2);
+        constexpr T min = std::numeric_limits<T>::min();
+        constexpr T max = std::numeric_limits<T>::max();
+        const Case current = {type, "SnugRange", HexOf(left), HexOf(right)};
+
+        const bool inside = left >= low && left <= high;
+        const T clamped = left < low ? low : left > high ? high : left;
+        const SnugIntResult<T> from = {left, inside ? SnugIntError::None : SnugIntError::SizeMismatch};
+        Expect(Same(SnugRange<T, low, high, SnugIntWrapPolicy>::TryFrom(left), from), current, "SnugRange::TryFrom");
+        Expect(SnugRange<T, low, high, SnugIntWrapPolicy>(left).getValue() == clamped, current, "SnugRange constructor wrapped");
+        Expect(SnugRange<T, low, high, SnugIntSaturatePolicy>(left).getValue() == clamped, current, "SnugRange constructor saturated");
+        Expect(ThrownBy([&] { SnugRange<T, low, high> range(left); static_cast<void>(range); }) == ThrownBy([&] { SnugIntThrow(from.error); }),
+               current, "SnugRange constructor");
+
+        const T other = right < low ? low : right > high ? high : right;
+        CheckRangePolicy<T, low, high, SnugIntWrapPolicy>(type, clamped, other);
+        CheckRangePolicy<T, low, high, SnugIntSaturatePolicy>(type, clamped, other);
+        CheckRangePolicy<T, low, high, SnugIntThrowPolicy>(type, clamped, other);
+        CheckRangePolicy<T, min, max, SnugIntWrapPolicy>(type, left, right);
+        CheckRangePolicy<T, min, max, SnugIntSaturatePolicy>(type, left, right);
+        CheckRangePolicy<T, min, max, SnugIntThrowPolicy>(type, left, right);
+    }
+
+    template<class T>
+    void CheckRange(const char*, T, T, std::false_type) {}
+
+    /**
+     * \brief A SnugCounter on one thread against the exact total and pending count of the deltas it accepted
+     *
+     * \details
+     * With flush_at 3 the small deltas stay in the slot of the thread and the others go to the total. A delta is
+     * accepted when the slot takes it or the total with it (and the slot, when it is merged) fits, a refused one
+     * leaves the count untouched. The deltas are the left operands, the right ones subtracted and left % 4
+     */
+    template<class T>
+    void CheckCounter(const char* type, const T* left, const T* right, std::size_t count, std::true_type)
+    {
+        typedef typename Reference<T>::type R;
+        const T flush_at = 3;
+        const R limit = R(flush_at);
+        const R lower = snug::detail::IsSigned<T>::value ? R(0) - limit : R(0);
+        SnugCounter<T, SnugIntWrapPolicy> counter(0, flush_at);
+        R total = R(0);
+        R pending = R(0);
+
+        for (std::size_t i = 0; i < 3 * count; ++i)
+        {
+            const bool subtract = i % 3 == 1;
+            const T delta = i % 3 == 0 ? left[i / 3] : subtract ? right[i / 3] : static_cast<T>(left[i / 3] % 4);
+            const Case current = {type, subtract ? "SnugCounter -=" : "SnugCounter +=", HexOf(static_cast<T>(total)), HexOf(delta)};
+
+            // an unsigned subtraction, and one of min, go to the total as a subtraction
+            const bool straight = subtract && (!snug::detail::IsSigned<T>::value || delta == std::numeric_limits<T>::min());
+            const R step = subtract ? R(0) - R(delta) : R(delta);
+            const bool slot = !straight && step <= limit && step >= lower;
+            const bool merge = slot && (pending + step > limit || pending + step < lower);
+            SnugIntError expected = SnugIntError::None;
+            if (straight)
+                expected = Expected<T>(total + step, SnugIntError::SubtractionOverflow, SnugIntError::SubtractionUnderflow).error;
+            else if (!slot || merge)
+                expected = Expected<T>(total + (merge ? pending : R(0)) + step, SnugIntError::AdditionOverflow,
+                                       SnugIntError::AdditionUnderflow).error;
+
+            Expect((subtract ? counter.TrySub(delta) : counter.TryAdd(delta)) == expected, current, "SnugCounter::TryAdd");
+            if (expected == SnugIntError::None && slot && !merge)
+                pending = pending + step;
+            else if (expected == SnugIntError::None)
+            {
+                total = total + (merge ? pending : R(0)) + step;
+                pending = merge ? R(0) : pending;
+            }
+            Expect(counter.approximate() == static_cast<T>(total), current, "SnugCounter::approximate");
+            Expect(Same(counter.TryExact(), Expected<T>(total + pending, SnugIntError::AdditionOverflow, SnugIntError::AdditionUnderflow)),
+                   current, "SnugCounter::TryExact");
+
+            if (i % 4 == 3)
+            {
+                const SnugIntError flushed = pending == R(0) ? SnugIntError::None
+                                                             : Expected<T>(total + pending, SnugIntError::AdditionOverflow,
+                                                                           SnugIntError::AdditionUnderflow).error;
+                Expect(counter.TryFlush() == flushed, current, "SnugCounter::TryFlush");
+                if (flushed == SnugIntError::None)
+                {
+                    total = total + pending;
+                    pending = R(0);
+                }
+                Expect(counter.approximate() == static_cast<T>(total), current, "SnugCounter::approximate after TryFlush");
+            }
+        }
+    }
+
+    template<class T>
+    void CheckCounter(const char*, const T*, const T*, std::size_t, std::false_type) {}
+
+    /**
+     * \brief Slots of opposite signs on two threads, the total near max only fits once both are added
+     */
+    template<class T>
+    void CheckCounterSlots(const char* type, T left, std::true_type)
+    {
+        const T start = static_cast<T>(std::numeric_limits<T>::max() - 5);
+        const T delta = static_cast<T>((left & 7) + 8);
+        const Case current = {type, "SnugCounter slots", HexOf(start), HexOf(delta)};
+        SnugCounter<T, SnugIntWrapPolicy, 4> counter(start, static_cast<T>(16));
+        Expect(counter.TryAdd(delta) == SnugIntError::None, current, "SnugCounter::TryAdd");
+        std::thread other([&] { Expect(counter.TrySub(delta) == SnugIntError::None, current, "SnugCounter::TrySub"); });
+        other.join();
+        Expect(Same(counter.TryExact(), SnugIntResult<T>{start, SnugIntError::None}), current, "SnugCounter::TryExact of two slots");
+    }
+
+    template<class T>
+    void CheckCounterSlots(const char*, T, std::false_type) {}
+
+    /**
+     * \brief Runs every check of T over the whole input
+     */
+    template<class T>
+    void CheckType(const char* type, Input input)
+    {
+        static const std::size_t capacity = 64;
+        T left[capacity];
+        T right[capacity];
+        std::size_t count = 0;
+
+        do
+        {
+            const T first = input.Value<T>();
+            const T second = input.Value<T>();
+            const typename Other<T>::type other = input.Value<typename Other<T>::type>();
+
+            CheckBinary<Add>(type, first, second, other);
+            CheckBinary<Sub>(type, first, second, other);
+            CheckBinary<Mult>(type, first, second, other);
+            CheckUnary(type, first, second);
+            CheckMixedMod(type, first, other);
+            CheckCasts(type, first);
+            CheckSize(type, first, static_cast<std::size_t>(second), static_cast<std::size_t>(other));
+            CheckChars(type, first);
+            CheckRange(type, first, second, std::integral_constant<bool, (sizeof(T) <= 8)>());
+#if SNUGINT_HAS_INT128
+            CheckScaledUnits(type, first, second, std::integral_constant<bool, (sizeof(T) <= 8)>());
+#endif
+
+            if (count < capacity)
+            {
+                left[count] = first;
+                right[count] = second;
+                ++count;
+            }
+        } while (!input.empty());
+
+        CheckBatch<Add>(type, left, right, count);
+        CheckBatch<Sub>(type, left, right, count);
+        CheckBatch<Mult>(type, left, right, count);
+        CheckProduct(type, left, count);
+        CheckProduct(type, right, count);
+        CheckProductEdges<T>(type, snug::detail::IsSigned<T>());
+        CheckReduce(type, left, right, count);
+        CheckParallel(type, left, right, count);
+        CheckColumn(type, left, right, count);
+        CheckCounter(type, left, right, count, std::integral_constant<bool, (sizeof(T) <= 8)>());
+        CheckAtomicThreads(type, left[0], std::integral_constant<bool, (sizeof(T) <= 8)>());
+        CheckCounterSlots(type, left[0], std::integral_constant<bool, (sizeof(T) <= 8 && snug::detail::IsSigned<T>::value)>());
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    const Input input = {data, size};
+    CheckType<std::int8_t>("int8", input);
+    CheckType<std::uint8_t>("uint8", input);
+    CheckType<std::int16_t>("int16", input);
+    CheckType<std::uint16_t>("uint16", input);
+    CheckType<std::int32_t>("int32", input);
+    CheckType<std::uint32_t>("uint32", input);
+    CheckType<std::int64_t>("int64", input);
+    CheckType<std::uint64_t>("uint64", input);
+#if SNUGINT_HAS_INT128
+    CheckType<__int128>("int128", input);
+    CheckType<unsigned __int128>("uint128", input);
+#endif
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+Copyright 2019 Stephen Tafoya <stephen@tafoya.dev>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+        limitations under the License.
+*/
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size);
+
+/**
+ * \brief Standalone driver of the SnugInt fuzz target, for builds without libFuzzer
+ *
+ * \details
+ * - snugint_fuzz <file>... runs every file once, e.g. a libFuzzer corpus or crash
+ * - snugint_fuzz without arguments runs stdin once, which is what AFL feeds an instrumented binary
+ * - snugint_fuzz --random=<count> [--seed=<seed>] runs count generated inputs of up to 1024 bytes,
+ *   a quarter of the bytes are biased to 0 or 0xff so the limits of each width come up often
+ *
+ * A mismatch aborts in LLVMFuzzerTestOneInput, so a zero exit status means every backend agreed.
+ */
+namespace
+{
+    int RunFile(const char* path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            std::fprintf(stderr, "snugint_fuzz: can not read %s\n", path);
+            return 1;
+        }
+        const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+        return 0;
+    }
+
+    int RunRandom(unsigned long long count, unsigned long long seed)
+    {
+        std::mt19937_64 generator(seed);
+        std::vector<std::uint8_t> data;
+        for (unsigned long long run = 0; run < count; ++run)
+        {
+            data.resize(static_cast<std::size_t>(generator() % 1025));
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+                const unsigned long long bits = generator();
+                data[i] = (bits & 0x300) == 0 ? static_cast<std::uint8_t>(bits & 1 ? 0xff : 0) : static_cast<std::uint8_t>(bits);
+            }
+            LLVMFuzzerTestOneInput(data.data(), data.size());
+        }
+        std::printf("snugint_fuzz: %llu random inputs agree (seed %llu)\n", count, seed);
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned long long count = 0;
+    unsigned long long seed = 1;
+    int files = 0;
+    int status = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], "--random=", 9) == 0)
+            count = std::strtoull(argv[i] + 9, nullptr, 10);
+        else if (std::strncmp(argv[i], "--seed=", 7) == 0)
+            seed = std::strtoull(argv[i] + 7, nullptr, 10);
+        else
+        {
+            status |= RunFile(argv[i]);
+            ++files;
+        }
+    }
+
+    if (count > 0)
+        return status | RunRandom(count, seed);
+    if (files == 0)
+    {
+        const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+    }
+    return status;
+}